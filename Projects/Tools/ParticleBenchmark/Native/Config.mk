@@ -0,0 +1,100 @@
+#-------------------------------------------------------------------
+# Config.mk
+# Chilli Source
+#
+# Created by agent on 17/10/2026
+# Copyright 2026 Tag Games. All rights reserved.
+#-------------------------------------------------------------------
+#-------------------------------------------------------------------
+# PROJECT_NAME
+#
+# The name of the project. This will be used as the output
+# exectable name.
+#-------------------------------------------------------------------
+PROJECT_NAME = ParticleBenchmark
+#-------------------------------------------------------------------
+# CHILLISOURCE_SOURCE_PATH
+#
+# The path to the Chilli Source engine source, relative to this
+# file.
+#-------------------------------------------------------------------
+CHILLISOURCE_SOURCE_PATH = ../../../../Source/
+#-------------------------------------------------------------------
+# CSBASE_SOURCE_PATH
+#
+# The path to the source of the third party libraries used by the
+# engine, relative to this file.
+#-------------------------------------------------------------------
+CSBASE_SOURCE_PATH = ../../../Libraries/CSBase/Source/
+#-------------------------------------------------------------------
+# PROJECT_INCLUDE_PATHS
+#
+# A list of all the include paths used. This should be in the format
+# -I<relativepath>
+#-------------------------------------------------------------------
+PROJECT_INCLUDE_PATHS = -ISource/ -I$(CHILLISOURCE_SOURCE_PATH) -I$(CSBASE_SOURCE_PATH)
+#-------------------------------------------------------------------
+# PROJECT_CPP_SOURCE_FILES
+#
+# A list of all the c++ sources to be built in the project. Only
+# the engine sources required by the particle pipeline are built;
+# anything which depends on the Application, file system or render
+# system is excluded.
+#-------------------------------------------------------------------
+PROJECT_CPP_SOURCE_FILES = Source/AllocationCounter.cpp \
+	Source/Logging.cpp \
+	Source/ExpansionCheck.cpp \
+	Source/IntegrationCheck.cpp \
+	Source/Main.cpp \
+	Source/PipelineBenchmark.cpp \
+	Source/Scenarios.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Base/ByteColour.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Base/Colour.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Base/ColourUtils.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Cryptographic/HashCRC32.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/File/CSBinaryChunk.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Math/FastRandom.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Math/Geometry/Shapes.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Math/Random.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Resource/Resource.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/Resource/ResourcePool.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/String/StringParser.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/String/StringUtils.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Core/String/ToString.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ParticleAffector.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ConcurrentParticleData.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDefFactory.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/PointParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/PointParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitter.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitterDef.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ParticleArray.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ParticleEffect.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ParticleIntegration.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ParticleMemoryManager.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/ParticleSimulationCache.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Property/ParticleCurve.cpp \
+	$(CHILLISOURCE_SOURCE_PATH)ChilliSource/Rendering/Particle/Property/ParticlePropertyFactoryImpl.cpp \
+	$(CSBASE_SOURCE_PATH)json/json_reader.cpp \
+	$(CSBASE_SOURCE_PATH)json/json_value.cpp \
+	$(CSBASE_SOURCE_PATH)json/json_writer.cpp
@@ -0,0 +1,125 @@
+//
+//  AllocationCounter.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<u64> g_totalAllocations(0);
+
+    //----------------------------------------------------------------
+    /// Allocates from the heap, counting the allocation.
+    ///
+    /// @author agent
+    ///
+    /// @param The size of the allocation in bytes.
+    ///
+    /// @return The allocated memory, or null if the allocation failed.
+    //----------------------------------------------------------------
+    void* CountedAllocate(std::size_t in_size) noexcept
+    {
+        g_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(in_size > 0 ? in_size : 1);
+    }
+}
+
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void* operator new(std::size_t in_size)
+{
+    void* memory = CountedAllocate(in_size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void* operator new[](std::size_t in_size)
+{
+    void* memory = CountedAllocate(in_size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void* operator new(std::size_t in_size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(in_size);
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void* operator new[](std::size_t in_size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(in_size);
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void operator delete(void* in_memory) noexcept
+{
+    std::free(in_memory);
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void operator delete[](void* in_memory) noexcept
+{
+    std::free(in_memory);
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void operator delete(void* in_memory, std::size_t) noexcept
+{
+    std::free(in_memory);
+}
+//----------------------------------------------------------------
+//----------------------------------------------------------------
+void operator delete[](void* in_memory, std::size_t) noexcept
+{
+    std::free(in_memory);
+}
+
+namespace ParticleBenchmark
+{
+    namespace AllocationCounter
+    {
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u64 GetTotalAllocations()
+        {
+            return g_totalAllocations.load(std::memory_order_relaxed);
+        }
+    }
+}
@@ -1,11 +1,11 @@
 //
-//  Particle.h
+//  AllocationCounter.h
 //  Chilli Source
-//  Created by Ian Copland on 07/10/2014.
+//  Created by agent on 17/10/2026.
 //
 //  The MIT License (MIT)
 //
-//  Copyright (c) 2014 Tag Games Limited
+//  Copyright (c) 2026 Tag Games Limited
 //
 //  Permission is hereby granted, free of charge, to any person obtaining a copy
 //  of this software and associated documentation files (the "Software"), to deal
@@ -26,35 +26,32 @@
 //  THE SOFTWARE.
 //
 
-#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
-#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
+#ifndef _PARTICLEBENCHMARK_ALLOCATIONCOUNTER_H_
+#define _PARTICLEBENCHMARK_ALLOCATIONCOUNTER_H_
 
 #include <ChilliSource/ChilliSource.h>
 
-#include <ChilliSource/Core/Math/Vector3.h>
-#include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Math/Quaternion.h>
-#include <ChilliSource/Core/Base/Colour.h>
-
-namespace ChilliSource
+namespace ParticleBenchmark
 {
-    //-----------------------------------------------------------------------
-    /// A struct containing the properties for a single particle.
+    //------------------------------------------------------------------------
+    /// Counts every allocation made through the global operator new. The
+    /// benchmark replaces the global allocation functions so that any heap
+    /// allocations made by the particle pipeline, including those made by
+    /// standard containers, can be attributed to the stage which made them.
     ///
-    /// @author Ian Copland
-    //-----------------------------------------------------------------------
-    struct Particle final
+    /// @author agent
+    //------------------------------------------------------------------------
+    namespace AllocationCounter
     {
-        bool m_isActive = false;
-        f32 m_lifetime = 0.0f;
-        f32 m_energy = 0.0f;
-        Vector3 m_position;
-        Vector2 m_scale = Vector2::k_one;
-        f32 m_rotation = 0.0f;
-        Colour m_colour = Colour::k_white;
-        Vector3 m_velocity;
-        f32 m_angularVelocity = 0.0f;
-    };
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total number of heap allocations made since the
+        /// application started. Sampling this before and after a section
+        /// of work gives the number of allocations it made.
+        //----------------------------------------------------------------
+        u64 GetTotalAllocations();
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,286 @@
+//
+//  ExpansionCheck.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "ExpansionCheck.h"
+
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace CS = ChilliSource;
+
+namespace ParticleBenchmark
+{
+    namespace ExpansionCheck
+    {
+        namespace
+        {
+            const u32 k_batchSizes[] = { 0, 1, 3, 4, 5, 7, 8, 61, 63, CS::ParticleBillboardExpansion::k_maxBatchSize };
+            const u32 k_numCameraOrientations = 8;
+            const u32 k_numComparisonsPerBatch = 3;
+            const u32 k_numSpriteVerts = (u32)CS::SpriteBatch::Verts::k_total;
+            const f32 k_tolerance = 0.0001f;
+            const u32 k_seed = 12345;
+
+            const CS::SpriteBatch::Verts k_corners[] = { CS::SpriteBatch::Verts::k_topLeft, CS::SpriteBatch::Verts::k_bottomLeft, CS::SpriteBatch::Verts::k_topRight, CS::SpriteBatch::Verts::k_bottomRight };
+            const char* k_cornerNames[] = { "top left", "bottom left", "top right", "bottom right" };
+
+            //----------------------------------------------------------------
+            /// A single randomised billboard, as it would be passed to the
+            /// batch by the drawable.
+            ///
+            /// @author agent
+            //----------------------------------------------------------------
+            struct Billboard
+            {
+                CS::Vector3 m_position;
+                CS::Vector2 m_bottomLeft;
+                CS::Vector2 m_topRight;
+                f32 m_rotation;
+            };
+            //----------------------------------------------------------------
+            /// Generates randomised billboards. The extents aren't always
+            /// centred on the position, as with anchored billboards, and the
+            /// rotations cover several full turns in both directions.
+            ///
+            /// @author agent
+            ///
+            /// @param The number of billboards.
+            /// @param The random number generator.
+            ///
+            /// @return The billboards.
+            //----------------------------------------------------------------
+            std::vector<Billboard> GenerateBillboards(u32 in_numBillboards, std::mt19937& inout_generator)
+            {
+                std::uniform_real_distribution<f32> positionDistribution(-100.0f, 100.0f);
+                std::uniform_real_distribution<f32> extentDistribution(0.0f, 5.0f);
+                std::uniform_real_distribution<f32> rotationDistribution(-20.0f, 20.0f);
+
+                std::vector<Billboard> billboards(in_numBillboards);
+                for (auto& billboard : billboards)
+                {
+                    billboard.m_position = CS::Vector3(positionDistribution(inout_generator), positionDistribution(inout_generator), positionDistribution(inout_generator));
+                    billboard.m_bottomLeft = CS::Vector2(-extentDistribution(inout_generator), -extentDistribution(inout_generator));
+                    billboard.m_topRight = CS::Vector2(extentDistribution(inout_generator), extentDistribution(inout_generator));
+                    billboard.m_rotation = rotationDistribution(inout_generator);
+                }
+
+                return billboards;
+            }
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The random number generator.
+            ///
+            /// @return A randomised camera orientation.
+            //----------------------------------------------------------------
+            CS::Quaternion GenerateCameraOrientation(std::mt19937& inout_generator)
+            {
+                std::uniform_real_distribution<f32> axisDistribution(-1.0f, 1.0f);
+                std::uniform_real_distribution<f32> angleDistribution(-3.14159265f, 3.14159265f);
+
+                CS::Vector3 axis;
+                do
+                {
+                    axis = CS::Vector3(axisDistribution(inout_generator), axisDistribution(inout_generator), axisDistribution(inout_generator));
+                }
+                while (axis.LengthSquared() < 0.01f);
+
+                return CS::Quaternion(CS::Vector3::Normalise(axis), angleDistribution(inout_generator));
+            }
+            //----------------------------------------------------------------
+            /// Calculates the corners of a billboard using the quaternion
+            /// maths which the static billboard drawable used prior to
+            /// billboard expansion.
+            ///
+            /// @author agent
+            ///
+            /// @param The billboard.
+            /// @param The world orientation of the camera.
+            /// @param [Out] The four vertices of the quad.
+            //----------------------------------------------------------------
+            void CalcReferenceCorners(const Billboard& in_billboard, const CS::Quaternion& in_cameraOrientation, CS::SpriteBatch::SpriteVertex* out_vertices)
+            {
+                CS::Quaternion worldOrientation = CS::Quaternion(CS::Vector3::k_unitPositiveZ, in_billboard.m_rotation) * in_cameraOrientation;
+
+                CS::Vector3 topLeft = in_billboard.m_position + CS::Vector3::Rotate(CS::Vector3(in_billboard.m_bottomLeft.x, in_billboard.m_topRight.y, 0.0f), worldOrientation);
+                CS::Vector3 topRight = in_billboard.m_position + CS::Vector3::Rotate(CS::Vector3(in_billboard.m_topRight.x, in_billboard.m_topRight.y, 0.0f), worldOrientation);
+                CS::Vector3 bottomLeft = in_billboard.m_position + CS::Vector3::Rotate(CS::Vector3(in_billboard.m_bottomLeft.x, in_billboard.m_bottomLeft.y, 0.0f), worldOrientation);
+                CS::Vector3 bottomRight = in_billboard.m_position + CS::Vector3::Rotate(CS::Vector3(in_billboard.m_topRight.x, in_billboard.m_bottomLeft.y, 0.0f), worldOrientation);
+
+                out_vertices[(u32)CS::SpriteBatch::Verts::k_topLeft].vPos = CS::Vector4(topLeft, 1.0f);
+                out_vertices[(u32)CS::SpriteBatch::Verts::k_bottomLeft].vPos = CS::Vector4(bottomLeft, 1.0f);
+                out_vertices[(u32)CS::SpriteBatch::Verts::k_topRight].vPos = CS::Vector4(topRight, 1.0f);
+                out_vertices[(u32)CS::SpriteBatch::Verts::k_bottomRight].vPos = CS::Vector4(bottomRight, 1.0f);
+            }
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The first value.
+            /// @param The second value.
+            ///
+            /// @return Whether or not the values are equal within the
+            /// tolerance, relative to their magnitude.
+            //----------------------------------------------------------------
+            bool IsEqual(f32 in_a, f32 in_b)
+            {
+                const f32 scale = std::fmax(1.0f, std::fmax(std::fabs(in_a), std::fabs(in_b)));
+                return std::fabs(in_a - in_b) <= k_tolerance * scale;
+            }
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The first vector.
+            /// @param The second vector.
+            ///
+            /// @return Whether or not the vectors are equal within the
+            /// tolerance.
+            //----------------------------------------------------------------
+            bool IsEqual(const CS::Vector4& in_a, const CS::Vector4& in_b)
+            {
+                return IsEqual(in_a.x, in_b.x) && IsEqual(in_a.y, in_b.y) && IsEqual(in_a.z, in_b.z) && IsEqual(in_a.w, in_b.w);
+            }
+            //----------------------------------------------------------------
+            /// Compares the vertex positions of two expansions, printing the
+            /// first mismatch found.
+            ///
+            /// @author agent
+            ///
+            /// @param The name of the tested path.
+            /// @param The name of the path it is compared against.
+            /// @param The size of the batch.
+            /// @param The index of the camera orientation.
+            /// @param The tested vertices.
+            /// @param The expected vertices.
+            ///
+            /// @return Whether or not the positions match.
+            //----------------------------------------------------------------
+            bool Compare(const char* in_pathName, const char* in_expectedPathName, u32 in_batchSize, u32 in_cameraIndex, const std::vector<CS::SpriteBatch::SpriteVertex>& in_vertices,
+                         const std::vector<CS::SpriteBatch::SpriteVertex>& in_expectedVertices)
+            {
+                for (u32 i = 0; i < in_batchSize; ++i)
+                {
+                    for (u32 corner = 0; corner < k_numSpriteVerts; ++corner)
+                    {
+                        const u32 index = i * k_numSpriteVerts + (u32)k_corners[corner];
+                        if (IsEqual(in_vertices[index].vPos, in_expectedVertices[index].vPos) == false)
+                        {
+                            std::fprintf(stderr, "%s differs from %s: %u billboards, camera %u, billboard %u %s corner.\n", in_pathName, in_expectedPathName, in_batchSize, in_cameraIndex, i, k_cornerNames[corner]);
+                            return false;
+                        }
+                    }
+                }
+
+                return true;
+            }
+            //----------------------------------------------------------------
+            /// Checks both expansion paths against each other and against
+            /// the reference corners for the given batch size and camera.
+            ///
+            /// @author agent
+            ///
+            /// @param The number of billboards in the batch.
+            /// @param The index of the camera orientation.
+            /// @param The random number generator.
+            ///
+            /// @return The number of failed comparisons.
+            //----------------------------------------------------------------
+            u32 CheckBatch(u32 in_batchSize, u32 in_cameraIndex, std::mt19937& inout_generator)
+            {
+                const CS::Quaternion cameraOrientation = GenerateCameraOrientation(inout_generator);
+                const CS::Vector3 cameraRight = CS::Vector3::Rotate(CS::Vector3::k_unitPositiveX, cameraOrientation);
+                const CS::Vector3 cameraUp = CS::Vector3::Rotate(CS::Vector3::k_unitPositiveY, cameraOrientation);
+
+                const auto billboards = GenerateBillboards(in_batchSize, inout_generator);
+                std::vector<CS::SpriteBatch::SpriteVertex> referenceVertices(in_batchSize * k_numSpriteVerts);
+                CS::ParticleBillboardExpansion::Batch batch;
+                for (u32 i = 0; i < in_batchSize; ++i)
+                {
+                    batch.Add(billboards[i].m_position, billboards[i].m_bottomLeft, billboards[i].m_topRight, billboards[i].m_rotation);
+                    CalcReferenceCorners(billboards[i], cameraOrientation, referenceVertices.data() + i * k_numSpriteVerts);
+                }
+
+                std::vector<CS::SpriteBatch::SpriteVertex> vertices(in_batchSize * k_numSpriteVerts);
+                std::vector<CS::SpriteBatch::SpriteVertex> scalarVertices(in_batchSize * k_numSpriteVerts);
+                CS::ParticleBillboardExpansion::Expand(batch, cameraRight, cameraUp, vertices.data());
+                CS::ParticleBillboardExpansion::ExpandScalar(batch, cameraRight, cameraUp, scalarVertices.data());
+
+                u32 numFailures = 0;
+                if (Compare("Expand", "ExpandScalar", in_batchSize, in_cameraIndex, vertices, scalarVertices) == false)
+                {
+                    ++numFailures;
+                }
+                if (Compare("Expand", "the quaternion corners", in_batchSize, in_cameraIndex, vertices, referenceVertices) == false)
+                {
+                    ++numFailures;
+                }
+                if (Compare("ExpandScalar", "the quaternion corners", in_batchSize, in_cameraIndex, scalarVertices, referenceVertices) == false)
+                {
+                    ++numFailures;
+                }
+
+                return numFailures;
+            }
+        }
+
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool Run()
+        {
+            std::mt19937 generator(k_seed);
+
+            u32 numChecks = 0;
+            u32 numFailures = 0;
+            for (u32 batchSize : k_batchSizes)
+            {
+                for (u32 cameraIndex = 0; cameraIndex < k_numCameraOrientations; ++cameraIndex)
+                {
+                    numChecks += k_numComparisonsPerBatch;
+                    numFailures += CheckBatch(batchSize, cameraIndex, generator);
+                }
+            }
+
+            if (numFailures > 0)
+            {
+                std::fprintf(stderr, "Expansion check failed: %u of %u checks did not match.\n", numFailures, numChecks);
+                return false;
+            }
+
+            std::printf("Expansion check passed: %u checks matched ExpandScalar and the quaternion corners.\n", numChecks);
+            return true;
+        }
+    }
+}
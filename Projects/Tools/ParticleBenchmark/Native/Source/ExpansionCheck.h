@@ -0,0 +1,61 @@
+//
+//  ExpansionCheck.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _PARTICLEBENCHMARK_EXPANSIONCHECK_H_
+#define _PARTICLEBENCHMARK_EXPANSIONCHECK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ParticleBenchmark
+{
+    //------------------------------------------------------------------------
+    /// Checks that the vectorised billboard expansion gives the same
+    /// results as both the scalar path and the quaternion corner maths
+    /// which the static billboard drawable previously used. Batches of
+    /// randomised billboards are expanded with Expand() and ExpandScalar()
+    /// for a number of randomised camera orientations, and each corner is
+    /// compared against the rotation of the local corner by the particle
+    /// rotation and camera orientation. A range of batch sizes are used so
+    /// that both the batched path and the scalar remainder are covered.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------
+    namespace ExpansionCheck
+    {
+        //----------------------------------------------------------------
+        /// Runs the check, printing any mismatches which are found.
+        ///
+        /// @author agent
+        ///
+        /// @return Whether or not all expansion paths matched.
+        //----------------------------------------------------------------
+        bool Run();
+    }
+}
+
+#endif
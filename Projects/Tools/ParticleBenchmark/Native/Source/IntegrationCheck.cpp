@@ -0,0 +1,324 @@
+//
+//  IntegrationCheck.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "IntegrationCheck.h"
+
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleIntegration.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace CS = ChilliSource;
+
+namespace ParticleBenchmark
+{
+    namespace IntegrationCheck
+    {
+        namespace
+        {
+            const u32 k_particleCounts[] = { 0, 1, 3, 4, 5, 7, 8, 61, 64, 1023 };
+            const u32 k_numSteps = 8;
+            const f32 k_deltaTime = 1.0f / 60.0f;
+            const f32 k_maxEnergy = 8.0f * k_deltaTime;
+            const f32 k_inactiveChance = 0.1f;
+            const f32 k_tolerance = 0.0001f;
+            const u32 k_seed = 12345;
+
+            //----------------------------------------------------------------
+            /// The ways in which an array can be integrated.
+            ///
+            /// @author agent
+            //----------------------------------------------------------------
+            enum class Path
+            {
+                k_integrate,
+                k_integrateRange,
+                k_integrateScalar
+            };
+
+            const char* k_pathNames[] = { "Integrate", "IntegrateRange", "IntegrateScalar" };
+
+            //----------------------------------------------------------------
+            /// Fills the given array with randomised particles. The same
+            /// seed will always produce the same particles. Some particles
+            /// are left inactive, and the energies are small enough that
+            /// most particles expire during the check.
+            ///
+            /// @author agent
+            ///
+            /// @param The number of particles to add.
+            /// @param The random seed.
+            /// @param [Out] The particle array.
+            //----------------------------------------------------------------
+            void FillParticleArray(u32 in_numParticles, u32 in_seed, CS::ParticleArray* out_particleArray)
+            {
+                std::mt19937 generator(in_seed);
+                std::uniform_real_distribution<f32> unitDistribution(0.0f, 1.0f);
+                std::uniform_real_distribution<f32> valueDistribution(-100.0f, 100.0f);
+                std::uniform_real_distribution<f32> energyDistribution(0.0f, k_maxEnergy);
+
+                out_particleArray->ReserveParticles(in_numParticles, CS::ParticleEffect::Priority::k_normal);
+                for (u32 i = 0; i < in_numParticles; ++i)
+                {
+                    u32 index = out_particleArray->AddParticle();
+                    out_particleArray->GetEnergies()[index] = energyDistribution(generator);
+                    out_particleArray->GetPositions()[index] = CS::Vector3(valueDistribution(generator), valueDistribution(generator), valueDistribution(generator));
+                    out_particleArray->GetVelocities()[index] = CS::Vector3(valueDistribution(generator), valueDistribution(generator), valueDistribution(generator));
+                    out_particleArray->GetRotations()[index] = valueDistribution(generator);
+                    out_particleArray->GetAngularVelocities()[index] = valueDistribution(generator);
+                    out_particleArray->GetActiveFlags()[index] = (unitDistribution(generator) >= k_inactiveChance);
+                }
+            }
+            //----------------------------------------------------------------
+            /// Integrates the given array with the given path. The range
+            /// path integrates the array in two ranges split at an index
+            /// which isn't a multiple of the batch size.
+            ///
+            /// @author agent
+            ///
+            /// @param The path to use.
+            /// @param Whether or not the bounds should be calculated.
+            /// @param [In/Out] The particle array.
+            /// @param [In/Out] The minimum of the bounds.
+            /// @param [In/Out] The maximum of the bounds.
+            //----------------------------------------------------------------
+            void Integrate(Path in_path, bool in_calcBounds, CS::ParticleArray* inout_particleArray, CS::Vector3& inout_min, CS::Vector3& inout_max)
+            {
+                switch (in_path)
+                {
+                    case Path::k_integrate:
+                        if (in_calcBounds == true)
+                        {
+                            CS::ParticleIntegration::Integrate(inout_particleArray, k_deltaTime, inout_min, inout_max);
+                        }
+                        else
+                        {
+                            CS::ParticleIntegration::Integrate(inout_particleArray, k_deltaTime);
+                        }
+                        break;
+                    case Path::k_integrateRange:
+                    {
+                        const u32 numParticles = inout_particleArray->GetNumActiveParticles();
+                        const u32 split = numParticles / 3;
+                        if (in_calcBounds == true)
+                        {
+                            CS::ParticleIntegration::IntegrateRange(inout_particleArray, 0, split, k_deltaTime, inout_min, inout_max);
+                            CS::ParticleIntegration::IntegrateRange(inout_particleArray, split, numParticles, k_deltaTime, inout_min, inout_max);
+                        }
+                        else
+                        {
+                            CS::ParticleIntegration::IntegrateRange(inout_particleArray, 0, split, k_deltaTime);
+                            CS::ParticleIntegration::IntegrateRange(inout_particleArray, split, numParticles, k_deltaTime);
+                        }
+                        break;
+                    }
+                    case Path::k_integrateScalar:
+                        if (in_calcBounds == true)
+                        {
+                            CS::ParticleIntegration::IntegrateScalar(inout_particleArray, k_deltaTime, inout_min, inout_max);
+                        }
+                        else
+                        {
+                            CS::ParticleIntegration::IntegrateScalar(inout_particleArray, k_deltaTime);
+                        }
+                        break;
+                }
+            }
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The first value.
+            /// @param The second value.
+            ///
+            /// @return Whether or not the values are equal within the
+            /// tolerance, relative to their magnitude. Infinite values, as
+            /// used by empty bounds, must match exactly.
+            //----------------------------------------------------------------
+            bool IsEqual(f32 in_a, f32 in_b)
+            {
+                if (in_a == in_b)
+                {
+                    return true;
+                }
+
+                const f32 scale = std::fmax(1.0f, std::fmax(std::fabs(in_a), std::fabs(in_b)));
+                return std::fabs(in_a - in_b) <= k_tolerance * scale;
+            }
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The first vector.
+            /// @param The second vector.
+            ///
+            /// @return Whether or not the vectors are equal within the
+            /// tolerance.
+            //----------------------------------------------------------------
+            bool IsEqual(const CS::Vector3& in_a, const CS::Vector3& in_b)
+            {
+                return IsEqual(in_a.x, in_b.x) && IsEqual(in_a.y, in_b.y) && IsEqual(in_a.z, in_b.z);
+            }
+            //----------------------------------------------------------------
+            /// Compares the state of an array integrated with the given path
+            /// against one integrated with the scalar path, printing the
+            /// first mismatch found.
+            ///
+            /// @author agent
+            ///
+            /// @param The path which was tested.
+            /// @param Whether or not the bounds were calculated.
+            /// @param The step which was just taken.
+            /// @param The tested particle array.
+            /// @param The tested minimum of the bounds.
+            /// @param The tested maximum of the bounds.
+            /// @param The scalar particle array.
+            /// @param The scalar minimum of the bounds.
+            /// @param The scalar maximum of the bounds.
+            ///
+            /// @return Whether or not the states match.
+            //----------------------------------------------------------------
+            bool Compare(Path in_path, bool in_calcBounds, u32 in_step, const CS::ParticleArray& in_particleArray, const CS::Vector3& in_min, const CS::Vector3& in_max,
+                         const CS::ParticleArray& in_scalarParticleArray, const CS::Vector3& in_scalarMin, const CS::Vector3& in_scalarMax)
+            {
+                const char* pathName = k_pathNames[static_cast<u32>(in_path)];
+                const char* boundsName = (in_calcBounds == true) ? " with bounds" : "";
+                const u32 numParticles = in_particleArray.GetNumActiveParticles();
+
+                for (u32 i = 0; i < numParticles; ++i)
+                {
+                    const char* field = nullptr;
+                    if (in_particleArray.GetActiveFlags()[i] != in_scalarParticleArray.GetActiveFlags()[i])
+                    {
+                        field = "active flag";
+                    }
+                    else if (IsEqual(in_particleArray.GetEnergies()[i], in_scalarParticleArray.GetEnergies()[i]) == false)
+                    {
+                        field = "energy";
+                    }
+                    else if (IsEqual(in_particleArray.GetPositions()[i], in_scalarParticleArray.GetPositions()[i]) == false)
+                    {
+                        field = "position";
+                    }
+                    else if (IsEqual(in_particleArray.GetRotations()[i], in_scalarParticleArray.GetRotations()[i]) == false)
+                    {
+                        field = "rotation";
+                    }
+
+                    if (field != nullptr)
+                    {
+                        std::fprintf(stderr, "%s%s differs from IntegrateScalar: %u particles, step %u, particle %u %s.\n", pathName, boundsName, numParticles, in_step, i, field);
+                        return false;
+                    }
+                }
+
+                if (in_calcBounds == true && (IsEqual(in_min, in_scalarMin) == false || IsEqual(in_max, in_scalarMax) == false))
+                {
+                    std::fprintf(stderr, "%s%s differs from IntegrateScalar: %u particles, step %u, bounds.\n", pathName, boundsName, numParticles, in_step);
+                    return false;
+                }
+
+                return true;
+            }
+            //----------------------------------------------------------------
+            /// Checks a single path against the scalar path for the given
+            /// number of particles.
+            ///
+            /// @author agent
+            ///
+            /// @param The path to check.
+            /// @param Whether or not the bounds should be calculated.
+            /// @param The number of particles.
+            /// @param The memory manager to allocate the arrays from.
+            ///
+            /// @return Whether or not the paths matched.
+            //----------------------------------------------------------------
+            bool CheckPath(Path in_path, bool in_calcBounds, u32 in_numParticles, CS::ParticleMemoryManager* in_memoryManager)
+            {
+                CS::ParticleArray particleArray(in_numParticles, in_memoryManager);
+                CS::ParticleArray scalarParticleArray(in_numParticles, in_memoryManager);
+                FillParticleArray(in_numParticles, k_seed + in_numParticles, &particleArray);
+                FillParticleArray(in_numParticles, k_seed + in_numParticles, &scalarParticleArray);
+
+                for (u32 step = 0; step < k_numSteps; ++step)
+                {
+                    CS::Vector3 min(std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity());
+                    CS::Vector3 max = -min;
+                    CS::Vector3 scalarMin = min;
+                    CS::Vector3 scalarMax = max;
+
+                    Integrate(in_path, in_calcBounds, &particleArray, min, max);
+                    Integrate(Path::k_integrateScalar, in_calcBounds, &scalarParticleArray, scalarMin, scalarMax);
+
+                    if (Compare(in_path, in_calcBounds, step, particleArray, min, max, scalarParticleArray, scalarMin, scalarMax) == false)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        }
+
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        bool Run()
+        {
+            CS::ParticleMemoryManager memoryManager;
+
+            u32 numChecks = 0;
+            u32 numFailures = 0;
+            for (u32 numParticles : k_particleCounts)
+            {
+                for (Path path : { Path::k_integrate, Path::k_integrateRange })
+                {
+                    for (bool calcBounds : { false, true })
+                    {
+                        ++numChecks;
+                        if (CheckPath(path, calcBounds, numParticles, &memoryManager) == false)
+                        {
+                            ++numFailures;
+                        }
+                    }
+                }
+            }
+
+            if (numFailures > 0)
+            {
+                std::fprintf(stderr, "Integration check failed: %u of %u checks did not match IntegrateScalar.\n", numFailures, numChecks);
+                return false;
+            }
+
+            std::printf("Integration check passed: %u checks matched IntegrateScalar.\n", numChecks);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+//
+//  IntegrationCheck.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _PARTICLEBENCHMARK_INTEGRATIONCHECK_H_
+#define _PARTICLEBENCHMARK_INTEGRATIONCHECK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ParticleBenchmark
+{
+    //------------------------------------------------------------------------
+    /// Checks that the vectorised particle integration gives the same
+    /// results as the scalar path. Arrays of randomised particles, some of
+    /// which are inactive or expire part way through, are integrated with
+    /// each of Integrate(), IntegrateRange() and IntegrateScalar() over a
+    /// number of steps, both with and without bounds, and the energies,
+    /// active flags, positions, rotations and bounds are compared after
+    /// every step. A range of particle counts are used so that both the
+    /// batched path and the scalar remainder are covered.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------
+    namespace IntegrationCheck
+    {
+        //----------------------------------------------------------------
+        /// Runs the check, printing any mismatches which are found.
+        ///
+        /// @author agent
+        ///
+        /// @return Whether or not all integration paths matched.
+        //----------------------------------------------------------------
+        bool Run();
+    }
+}
+
+#endif
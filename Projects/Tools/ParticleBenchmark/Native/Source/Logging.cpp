@@ -0,0 +1,104 @@
+//
+//  Logging.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+//The engine's logging is normally created by the Application and implemented per platform. The benchmark runs
+//without either, so provides its own implementation which writes to the standard output.
+
+#include <ChilliSource/Core/Base/Logging.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace ChilliSource
+{
+    Logging* Logging::s_logging = nullptr;
+
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    Logging* Logging::Get()
+    {
+        if (s_logging == nullptr)
+        {
+            Create();
+        }
+        return s_logging;
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::Create()
+    {
+        if (s_logging == nullptr)
+        {
+            s_logging = new Logging();
+        }
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::Destroy()
+    {
+        delete s_logging;
+        s_logging = nullptr;
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    Logging::Logging()
+    {
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::LogVerbose(const std::string& in_message)
+    {
+        LogMessage(LogLevel::k_verbose, in_message);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::LogWarning(const std::string& in_message)
+    {
+        LogMessage(LogLevel::k_warning, "WARNING: " + in_message);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::LogError(const std::string& in_message)
+    {
+        LogMessage(LogLevel::k_error, "ERROR: " + in_message);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::LogFatal(const std::string& in_message)
+    {
+        LogMessage(LogLevel::k_error, "FATAL: " + in_message);
+        std::exit(1);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    void Logging::LogMessage(LogLevel in_logLevel, const std::string& in_message)
+    {
+        std::FILE* stream = (in_logLevel == LogLevel::k_verbose) ? stdout : stderr;
+        std::fprintf(stream, "%s\n", in_message.c_str());
+    }
+}
@@ -0,0 +1,186 @@
+//
+//  Main.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "ExpansionCheck.h"
+#include "IntegrationCheck.h"
+#include "PipelineBenchmark.h"
+#include "Scenario.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace CS = ChilliSource;
+
+namespace
+{
+    //-------------------------------------------------
+    /// Displays the help messages.
+    ///
+    /// @author agent
+    //-------------------------------------------------
+    void DisplayHelp()
+    {
+        std::printf("Usage: ParticleBenchmark [options]\n");
+        std::printf("Runs the particle pipeline headlessly for each scenario, reporting the time and allocations of each stage.\n\n");
+        std::printf("Options:\n");
+        std::printf("  --effects <n>     The number of effect instances in each scenario. Defaults to 16.\n");
+        std::printf("  --particles <n>   The maximum number of particles in each effect. Defaults to 4096.\n");
+        std::printf("  --frames <n>      The number of measured frames. Defaults to 600.\n");
+        std::printf("  --warmup <n>      The number of unmeasured frames run first. Defaults to 180.\n");
+        std::printf("  --scenario <name> Only runs the scenario with the given name.\n");
+        std::printf("  --verify          Checks the vectorised integration and billboard expansion match the scalar paths, instead of benchmarking.\n");
+        std::printf("  --help            Displays this message.\n\n");
+        std::printf("Scenarios:\n");
+        for (const auto& scenario : ParticleBenchmark::CreateScenarios())
+        {
+            std::printf("  %-17s %s\n", scenario.m_name.c_str(), scenario.m_description.c_str());
+        }
+    }
+    //-------------------------------------------------
+    /// Reads an integer option value.
+    ///
+    /// @author agent
+    ///
+    /// @param The name of the option.
+    /// @param The value string, which may be null if the
+    /// option was the last argument.
+    /// @param The minimum valid value.
+    /// @param [Out] The value.
+    ///
+    /// @return Whether or not a valid value was read.
+    //-------------------------------------------------
+    bool ReadCount(const char* in_option, const char* in_value, u32 in_minValue, u32& out_value)
+    {
+        if (in_value != nullptr)
+        {
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(in_value, &end, 10);
+            if (end != in_value && *end == '\0' && value >= in_minValue)
+            {
+                out_value = u32(value);
+                return true;
+            }
+        }
+
+        std::fprintf(stderr, "Option %s requires an integer value of at least %u.\n", in_option, in_minValue);
+        return false;
+    }
+}
+
+//-------------------------------------------------
+/// The entry point for the application.
+///
+/// @author agent
+///
+/// @param The number of arguments.
+/// @param The arguments.
+///
+/// @return The exit code.
+//-------------------------------------------------
+int main(int in_argc, char* in_argv[])
+{
+    ParticleBenchmark::PipelineBenchmark::Options options;
+    std::string scenarioName;
+
+    for (int i = 1; i < in_argc; ++i)
+    {
+        const char* argument = in_argv[i];
+        const char* value = (i + 1 < in_argc) ? in_argv[i + 1] : nullptr;
+
+        bool valid = true;
+        if (std::strcmp(argument, "--effects") == 0)
+        {
+            valid = ReadCount(argument, value, 1, options.m_numEffects);
+            ++i;
+        }
+        else if (std::strcmp(argument, "--particles") == 0)
+        {
+            valid = ReadCount(argument, value, 1, options.m_numParticles);
+            ++i;
+        }
+        else if (std::strcmp(argument, "--frames") == 0)
+        {
+            valid = ReadCount(argument, value, 1, options.m_numFrames);
+            ++i;
+        }
+        else if (std::strcmp(argument, "--warmup") == 0)
+        {
+            valid = ReadCount(argument, value, 0, options.m_numWarmUpFrames);
+            ++i;
+        }
+        else if (std::strcmp(argument, "--scenario") == 0 && value != nullptr)
+        {
+            scenarioName = value;
+            ++i;
+        }
+        else if (std::strcmp(argument, "--verify") == 0)
+        {
+            bool integrationPassed = ParticleBenchmark::IntegrationCheck::Run();
+            bool expansionPassed = ParticleBenchmark::ExpansionCheck::Run();
+            return (integrationPassed == true && expansionPassed == true) ? 0 : 1;
+        }
+        else if (std::strcmp(argument, "--help") == 0)
+        {
+            DisplayHelp();
+            return 0;
+        }
+        else
+        {
+            std::fprintf(stderr, "Invalid argument: %s\n\n", argument);
+            valid = false;
+        }
+
+        if (valid == false)
+        {
+            DisplayHelp();
+            return 1;
+        }
+    }
+
+    bool scenarioFound = false;
+    for (const auto& scenario : ParticleBenchmark::CreateScenarios())
+    {
+        if (scenarioName.empty() == false && scenario.m_name != scenarioName)
+        {
+            continue;
+        }
+
+        scenarioFound = true;
+        ParticleBenchmark::PipelineBenchmark::PrintResults(ParticleBenchmark::PipelineBenchmark::Run(scenario, options));
+    }
+
+    if (scenarioFound == false)
+    {
+        std::fprintf(stderr, "Unknown scenario: %s\n", scenarioName.c_str());
+        return 1;
+    }
+
+    return 0;
+}
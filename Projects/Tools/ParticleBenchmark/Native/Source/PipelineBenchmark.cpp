@@ -0,0 +1,415 @@
+//
+//  PipelineBenchmark.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "PipelineBenchmark.h"
+
+#include "AllocationCounter.h"
+
+#include <ChilliSource/Core/Base/ColourUtils.h>
+#include <ChilliSource/Core/Base/Logging.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleIntegration.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace CS = ChilliSource;
+
+namespace ParticleBenchmark
+{
+    namespace PipelineBenchmark
+    {
+        namespace
+        {
+            const u32 k_numSpriteVerts = 4;
+            const u32 k_arenaBytesPerParticle = 512;
+            const f32 k_effectSpacing = 10.0f;
+
+            const char* k_stageNames[] = { "integrate", "remove", "affect", "emit", "commit", "billboard" };
+
+            //----------------------------------------------------------------
+            /// The state of a single effect instance: its particles, emitter,
+            /// affectors and concurrent data, as owned by a particle effect
+            /// component.
+            ///
+            /// @author agent
+            //----------------------------------------------------------------
+            struct EffectInstance final
+            {
+                CS::ParticleArrayUPtr m_particleArray;
+                CS::ParticleEmitterUPtr m_emitter;
+                std::vector<CS::ParticleAffectorUPtr> m_affectors;
+                CS::ConcurrentParticleDataUPtr m_concurrentParticleData;
+                CS::Vector3 m_position;
+            };
+            //----------------------------------------------------------------
+            /// Runs a single stage of the pipeline. If results are given, the
+            /// time taken and the allocations made are added to them.
+            ///
+            /// @author agent
+            ///
+            /// @param The memory manager which the particle storage is
+            /// allocated from.
+            /// @param [Out] The results to add to, or null if the stage
+            /// shouldn't be measured.
+            /// @param The stage. This should return the number of particles
+            /// which were processed.
+            //----------------------------------------------------------------
+            void RunStage(const CS::ParticleMemoryManager& in_memoryManager, StageResult* out_result, const std::function<u32()>& in_stage)
+            {
+                if (out_result == nullptr)
+                {
+                    in_stage();
+                    return;
+                }
+
+                const u64 heapAllocations = AllocationCounter::GetTotalAllocations();
+                const u64 arenaAllocations = in_memoryManager.GetTotalAllocations();
+                const auto startTime = std::chrono::steady_clock::now();
+
+                const u32 numParticles = in_stage();
+
+                const auto endTime = std::chrono::steady_clock::now();
+                out_result->m_timeNs += u64(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+                out_result->m_numParticles += numParticles;
+                out_result->m_numHeapAllocations += AllocationCounter::GetTotalAllocations() - heapAllocations;
+                out_result->m_numArenaAllocations += in_memoryManager.GetTotalAllocations() - arenaAllocations;
+            }
+            //----------------------------------------------------------------
+            /// Removes any particles which have been deactivated, in the same
+            /// way as the particle system's update.
+            ///
+            /// @author agent
+            ///
+            /// @param The effect instance.
+            //----------------------------------------------------------------
+            void RemoveInactiveParticles(EffectInstance& inout_instance)
+            {
+                CS::ParticleArray* particleArray = inout_instance.m_particleArray.get();
+                const CS::dynamic_array<bool>& activeFlags = particleArray->GetActiveFlags();
+
+                u32 index = 0;
+                while (index < particleArray->GetNumActiveParticles())
+                {
+                    if (activeFlags[index] == true)
+                    {
+                        ++index;
+                    }
+                    else
+                    {
+                        u32 lastIndex = particleArray->GetNumActiveParticles() - 1;
+                        particleArray->RemoveParticle(index);
+
+                        if (index != lastIndex)
+                        {
+                            for (auto& affector : inout_instance.m_affectors)
+                            {
+                                affector->MoveParticle(lastIndex, index);
+                            }
+                        }
+                    }
+                }
+
+                particleArray->ReleaseUnusedParticles();
+            }
+            //----------------------------------------------------------------
+            /// Builds the billboards for all committed particles, in the same
+            /// way as the static billboard drawable: the colour of each quad
+            /// is written, then the corner positions are calculated through
+            /// billboard expansion.
+            ///
+            /// @author agent
+            ///
+            /// @param The concurrent particle data.
+            /// @param [Out] The vertices. This must be large enough for every
+            /// particle.
+            ///
+            /// @return The number of billboards built.
+            //----------------------------------------------------------------
+            u32 BuildBillboards(CS::ConcurrentParticleData* in_concurrentParticleData, std::vector<CS::SpriteBatch::SpriteVertex>& out_vertices)
+            {
+                const CS::Vector3 cameraRight = CS::Vector3::k_unitPositiveX;
+                const CS::Vector3 cameraUp = CS::Vector3::k_unitPositiveY;
+                const CS::Vector2 bottomLeft(-0.5f, -0.5f);
+                const CS::Vector2 topRight(0.5f, 0.5f);
+
+                in_concurrentParticleData->FetchCommittedData();
+                const auto& particles = in_concurrentParticleData->GetParticles();
+                const u32 numParticles = in_concurrentParticleData->GetNumParticles();
+
+                CS::ParticleBillboardExpansion::Batch batch;
+                u32 numQuads = 0;
+                for (u32 i = 0; i < numParticles; ++i)
+                {
+                    const auto& particle = particles[i];
+
+                    const CS::ByteColour colour = CS::ColourUtils::ColourToByteColour(particle.m_colour);
+                    for (u32 vertex = 0; vertex < k_numSpriteVerts; ++vertex)
+                    {
+                        out_vertices[numQuads * k_numSpriteVerts + vertex].Col = colour;
+                    }
+
+                    batch.Add(particle.m_position, bottomLeft * particle.m_scale, topRight * particle.m_scale, particle.m_rotation);
+                    ++numQuads;
+
+                    if (batch.m_size == CS::ParticleBillboardExpansion::k_maxBatchSize || i + 1 == numParticles)
+                    {
+                        CS::ParticleBillboardExpansion::Expand(batch, cameraRight, cameraUp, out_vertices.data() + (numQuads - batch.m_size) * k_numSpriteVerts);
+                        batch.m_size = 0;
+                    }
+                }
+
+                return numQuads;
+            }
+            //----------------------------------------------------------------
+            /// Simulates a single frame of a single effect instance.
+            ///
+            /// @author agent
+            ///
+            /// @param The particle effect.
+            /// @param The memory manager.
+            /// @param The frame time.
+            /// @param The playback time at the end of the frame.
+            /// @param Whether or not this is the first frame.
+            /// @param [Out] The vertices to build billboards into.
+            /// @param [Out] The results to add to, or null if the frame
+            /// shouldn't be measured.
+            /// @param [In/Out] The effect instance.
+            //----------------------------------------------------------------
+            void UpdateInstance(const CS::ParticleEffect* in_particleEffect, const CS::ParticleMemoryManager& in_memoryManager, f32 in_frameTime, f32 in_playbackTime,
+                bool in_firstFrame, std::vector<CS::SpriteBatch::SpriteVertex>& out_vertices, Results* out_results, EffectInstance& inout_instance)
+            {
+                auto stageResult = [=](Stage in_stage) -> StageResult*
+                {
+                    return (out_results != nullptr) ? &out_results->m_stages[u32(in_stage)] : nullptr;
+                };
+
+                CS::ParticleArray* particleArray = inout_instance.m_particleArray.get();
+                const f32 effectProgress = in_playbackTime / in_particleEffect->GetDuration();
+
+                CS::Vector3 min(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+                CS::Vector3 max = -min;
+
+                RunStage(in_memoryManager, stageResult(Stage::k_integrate), [&]()
+                {
+                    const u32 numParticles = particleArray->GetNumActiveParticles();
+                    CS::ParticleIntegration::Integrate(particleArray, in_frameTime, min, max);
+                    return numParticles;
+                });
+
+                RunStage(in_memoryManager, stageResult(Stage::k_remove), [&]()
+                {
+                    const u32 numParticles = particleArray->GetNumActiveParticles();
+                    RemoveInactiveParticles(inout_instance);
+                    return numParticles;
+                });
+
+                RunStage(in_memoryManager, stageResult(Stage::k_affect), [&]()
+                {
+                    const u32 numParticles = particleArray->GetNumActiveParticles();
+                    for (auto& affector : inout_instance.m_affectors)
+                    {
+                        affector->AffectParticles(in_frameTime, effectProgress, 0, numParticles);
+                    }
+                    return numParticles;
+                });
+
+                const u32 numExistingParticles = particleArray->GetNumActiveParticles();
+                RunStage(in_memoryManager, stageResult(Stage::k_emit), [&]()
+                {
+                    std::vector<u32> newIndices = inout_instance.m_emitter->TryEmit(in_playbackTime, inout_instance.m_position, CS::Vector3::k_one, CS::Quaternion::k_identity,
+                        in_firstFrame == false, 1.0f, 1.0f);
+
+                    for (u32 newIndex : newIndices)
+                    {
+                        for (auto& affector : inout_instance.m_affectors)
+                        {
+                            affector->ActivateParticle(newIndex, effectProgress);
+                        }
+                    }
+                    return u32(newIndices.size());
+                });
+
+                RunStage(in_memoryManager, stageResult(Stage::k_commit), [&]()
+                {
+                    const u32 numParticles = particleArray->GetNumActiveParticles();
+                    //the bounds of the existing particles were calculated during integration, so only new particles are added.
+                    const CS::dynamic_array<CS::Vector3>& positions = particleArray->GetPositions();
+                    for (u32 i = numExistingParticles; i < numParticles; ++i)
+                    {
+                        min.Min(positions[i]);
+                        max.Max(positions[i]);
+                    }
+
+                    if (numParticles == 0)
+                    {
+                        min = CS::Vector3::k_zero;
+                        max = CS::Vector3::k_zero;
+                    }
+
+                    const CS::Vector3 size = max - min;
+                    const CS::Vector3 centre = min + 0.5f * size;
+
+                    bool updateStarted = inout_instance.m_concurrentParticleData->StartUpdate();
+                    if (updateStarted == false)
+                    {
+                        CS_LOG_FATAL("Failed to start a benchmark particle update.");
+                    }
+
+                    inout_instance.m_concurrentParticleData->CommitParticleData(particleArray, CS::AABB(centre, size), CS::Sphere(centre, size.Length() * 0.5f));
+                    return numParticles;
+                });
+
+                RunStage(in_memoryManager, stageResult(Stage::k_billboard), [&]()
+                {
+                    return BuildBillboards(inout_instance.m_concurrentParticleData.get(), out_vertices);
+                });
+            }
+            //----------------------------------------------------------------
+            /// Prints a single row of the results table.
+            ///
+            /// @author agent
+            ///
+            /// @param The name of the row.
+            /// @param The stage result.
+            /// @param The number of measured frames.
+            //----------------------------------------------------------------
+            void PrintRow(const char* in_name, const StageResult& in_result, u32 in_numFrames)
+            {
+                const double timeMs = double(in_result.m_timeNs) / 1000000.0;
+                const double nsPerParticle = (in_result.m_numParticles > 0) ? double(in_result.m_timeNs) / double(in_result.m_numParticles) : 0.0;
+                const double particlesPerFrame = double(in_result.m_numParticles) / double(in_numFrames);
+
+                std::printf("  %-10s %12.3f %16.0f %12.2f %12llu %12llu\n", in_name, timeMs, particlesPerFrame, nsPerParticle, (unsigned long long)in_result.m_numHeapAllocations,
+                    (unsigned long long)in_result.m_numArenaAllocations);
+            }
+        }
+
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Results Run(const Scenario& in_scenario, const Options& in_options)
+        {
+            Results results;
+            results.m_scenarioName = in_scenario.m_name;
+            results.m_options = in_options;
+
+            //the memory manager is declared first so that it outlives all particle storage.
+            CS::ParticleMemoryManager memoryManager(std::size_t(in_options.m_numEffects) * in_options.m_numParticles * k_arenaBytesPerParticle);
+
+            CS::ResourcePoolUPtr resourcePool = CS::ResourcePool::Create();
+            CS::ParticleEffectSPtr particleEffect = resourcePool->CreateResource<CS::ParticleEffect>(in_scenario.m_name);
+            particleEffect->SetMaxParticles(in_options.m_numParticles);
+            in_scenario.m_buildDelegate(particleEffect.get());
+
+            const u64 setupHeapAllocations = AllocationCounter::GetTotalAllocations();
+
+            std::vector<EffectInstance> instances(in_options.m_numEffects);
+            for (u32 i = 0; i < in_options.m_numEffects; ++i)
+            {
+                EffectInstance& instance = instances[i];
+                instance.m_particleArray = CS::ParticleArrayUPtr(new CS::ParticleArray(in_options.m_numParticles, &memoryManager));
+                instance.m_emitter = particleEffect->GetEmitterDef()->CreateInstance(instance.m_particleArray.get());
+                for (const auto& affectorDef : particleEffect->GetAffectorDefs())
+                {
+                    instance.m_affectors.push_back(affectorDef->CreateInstance(instance.m_particleArray.get()));
+                }
+                instance.m_concurrentParticleData = CS::ConcurrentParticleDataUPtr(new CS::ConcurrentParticleData(in_options.m_numParticles, &memoryManager));
+                instance.m_position = CS::Vector3(f32(i) * k_effectSpacing, 0.0f, 0.0f);
+            }
+
+            results.m_numSetupHeapAllocations = AllocationCounter::GetTotalAllocations() - setupHeapAllocations;
+            results.m_numSetupArenaAllocations = memoryManager.GetTotalAllocations();
+
+            std::vector<CS::SpriteBatch::SpriteVertex> vertices(std::size_t(in_options.m_numParticles) * k_numSpriteVerts);
+
+            const f32 duration = particleEffect->GetDuration();
+            const u32 numFrames = in_options.m_numWarmUpFrames + in_options.m_numFrames;
+            f32 playbackTime = 0.0f;
+            for (u32 frame = 0; frame < numFrames; ++frame)
+            {
+                playbackTime += in_options.m_frameTime;
+                while (playbackTime >= duration)
+                {
+                    playbackTime -= duration;
+                }
+
+                Results* frameResults = (frame >= in_options.m_numWarmUpFrames) ? &results : nullptr;
+                for (auto& instance : instances)
+                {
+                    UpdateInstance(particleEffect.get(), memoryManager, in_options.m_frameTime, playbackTime, frame == 0, vertices, frameResults, instance);
+                }
+            }
+
+            results.m_numOverflowAllocations = memoryManager.GetTotalOverflowAllocations();
+            results.m_peakLiveParticles = memoryManager.GetPeakLiveParticles();
+            return results;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void PrintResults(const Results& in_results)
+        {
+            const Options& options = in_results.m_options;
+            std::printf("%s: %u effects x %u particles, %u frames (%u warm up)\n", in_results.m_scenarioName.c_str(), options.m_numEffects, options.m_numParticles, options.m_numFrames,
+                options.m_numWarmUpFrames);
+            std::printf("  %-10s %12s %16s %12s %12s %12s\n", "stage", "total ms", "particles/frame", "ns/particle", "heap allocs", "arena allocs");
+
+            StageResult total;
+            for (u32 i = 0; i < u32(Stage::k_total); ++i)
+            {
+                const StageResult& stage = in_results.m_stages[i];
+                PrintRow(k_stageNames[i], stage, options.m_numFrames);
+
+                total.m_timeNs += stage.m_timeNs;
+                total.m_numHeapAllocations += stage.m_numHeapAllocations;
+                total.m_numArenaAllocations += stage.m_numArenaAllocations;
+            }
+
+            //the total cost is given per simulated particle, rather than per particle processed by any stage.
+            total.m_numParticles = in_results.m_stages[u32(Stage::k_integrate)].m_numParticles;
+            PrintRow("total", total, options.m_numFrames);
+
+            std::printf("  setup: %llu heap allocs, %llu arena allocs; %llu arena overflows; peak %u live particles\n\n", (unsigned long long)in_results.m_numSetupHeapAllocations,
+                (unsigned long long)in_results.m_numSetupArenaAllocations, (unsigned long long)in_results.m_numOverflowAllocations, in_results.m_peakLiveParticles);
+        }
+    }
+}
@@ -0,0 +1,134 @@
+//
+//  PipelineBenchmark.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _PARTICLEBENCHMARK_PIPELINEBENCHMARK_H_
+#define _PARTICLEBENCHMARK_PIPELINEBENCHMARK_H_
+
+#include "Scenario.h"
+
+#include <array>
+#include <string>
+
+namespace ParticleBenchmark
+{
+    //------------------------------------------------------------------------
+    /// Runs the particle pipeline for a scenario on the calling thread,
+    /// without an Application, task scheduler or render system. Each frame
+    /// every effect is integrated, has its inactive particles removed, is
+    /// affected, emits new particles, is committed to its concurrent
+    /// particle data, and then has its billboards built from the committed
+    /// data, as the drawable would. Each of these stages is timed and has
+    /// its allocations counted separately.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------
+    namespace PipelineBenchmark
+    {
+        //----------------------------------------------------------------
+        /// The stages of the pipeline which are measured.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        enum class Stage
+        {
+            k_integrate,
+            k_remove,
+            k_affect,
+            k_emit,
+            k_commit,
+            k_billboard,
+            k_total
+        };
+        //----------------------------------------------------------------
+        /// The options used when running a scenario.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct Options final
+        {
+            u32 m_numEffects = 16;
+            u32 m_numParticles = 4096;
+            u32 m_numWarmUpFrames = 180;
+            u32 m_numFrames = 600;
+            f32 m_frameTime = 1.0f / 60.0f;
+        };
+        //----------------------------------------------------------------
+        /// The measurements for a single stage. The number of particles
+        /// is the number processed by the stage summed over every effect
+        /// and frame; for emission this is the number emitted.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct StageResult final
+        {
+            u64 m_timeNs = 0;
+            u64 m_numParticles = 0;
+            u64 m_numHeapAllocations = 0;
+            u64 m_numArenaAllocations = 0;
+        };
+        //----------------------------------------------------------------
+        /// The results of running a single scenario.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct Results final
+        {
+            std::string m_scenarioName;
+            Options m_options;
+            std::array<StageResult, u32(Stage::k_total)> m_stages;
+            u64 m_numSetupHeapAllocations = 0;
+            u64 m_numSetupArenaAllocations = 0;
+            u64 m_numOverflowAllocations = 0;
+            u32 m_peakLiveParticles = 0;
+        };
+        //----------------------------------------------------------------
+        /// Runs the given scenario with the given options. The warm up
+        /// frames are simulated but not measured, so that the effects are
+        /// measured in their steady state.
+        ///
+        /// @author agent
+        ///
+        /// @param The scenario.
+        /// @param The options.
+        ///
+        /// @return The results.
+        //----------------------------------------------------------------
+        Results Run(const Scenario& in_scenario, const Options& in_options);
+        //----------------------------------------------------------------
+        /// Prints the given results to the standard output as a table with
+        /// a row for each stage.
+        ///
+        /// @author agent
+        ///
+        /// @param The results.
+        //----------------------------------------------------------------
+        void PrintResults(const Results& in_results);
+    }
+}
+
+#endif
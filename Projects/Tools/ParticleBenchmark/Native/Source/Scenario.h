@@ -0,0 +1,74 @@
+//
+//  Scenario.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _PARTICLEBENCHMARK_SCENARIO_H_
+#define _PARTICLEBENCHMARK_SCENARIO_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ParticleBenchmark
+{
+    //------------------------------------------------------------------------
+    /// A single benchmark scenario. This describes a particle effect which
+    /// is built entirely in code, so no resources need to be loaded. Each
+    /// scenario is run for a number of effect instances, each with a given
+    /// maximum number of particles.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------
+    struct Scenario final
+    {
+        //----------------------------------------------------------------
+        /// A delegate which fills out the given particle effect. The
+        /// maximum number of particles has already been set on the effect
+        /// when this is called, and should be used to scale the emission.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect to build.
+        //----------------------------------------------------------------
+        using BuildDelegate = std::function<void(ChilliSource::ParticleEffect* out_particleEffect)>;
+
+        std::string m_name;
+        std::string m_description;
+        BuildDelegate m_buildDelegate;
+    };
+    //------------------------------------------------------------------------
+    /// @author agent
+    ///
+    /// @return All of the benchmark scenarios, in the order they should be
+    /// run.
+    //------------------------------------------------------------------------
+    std::vector<Scenario> CreateScenarios();
+}
+
+#endif
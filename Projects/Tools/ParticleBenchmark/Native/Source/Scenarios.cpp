@@ -0,0 +1,214 @@
+//
+//  Scenarios.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "Scenario.h"
+
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitterDef.h>
+#include <ChilliSource/Rendering/Particle/Property/ConstantParticleProperty.h>
+#include <ChilliSource/Rendering/Particle/Property/RandomConstantParticleProperty.h>
+
+namespace CS = ChilliSource;
+
+namespace ParticleBenchmark
+{
+    namespace
+    {
+        const f32 k_minLifetime = 1.5f;
+        const f32 k_maxLifetime = 2.5f;
+        const f32 k_minShortLifetime = 0.4f;
+        const f32 k_maxShortLifetime = 0.6f;
+
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The value of the property.
+        ///
+        /// @return A new constant particle property.
+        //----------------------------------------------------------------
+        template <typename TType> CS::ParticlePropertyUPtr<TType> MakeConstant(TType in_value)
+        {
+            return CS::ParticlePropertyUPtr<TType>(new CS::ConstantParticleProperty<TType>(in_value));
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The lower value of the property.
+        /// @param The upper value of the property.
+        ///
+        /// @return A new random constant particle property.
+        //----------------------------------------------------------------
+        template <typename TType> CS::ParticlePropertyUPtr<TType> MakeRandom(TType in_lowerValue, TType in_upperValue)
+        {
+            return CS::ParticlePropertyUPtr<TType>(new CS::RandomConstantParticleProperty<TType>(in_lowerValue, in_upperValue));
+        }
+        //----------------------------------------------------------------
+        /// Sets the particle properties shared by all scenarios: a random
+        /// lifetime, speed, scale and rotation.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        //----------------------------------------------------------------
+        void SetCommonProperties(CS::ParticleEffect* out_particleEffect)
+        {
+            out_particleEffect->SetDuration(5.0f);
+            out_particleEffect->SetLifetimeProperty(MakeRandom(k_minLifetime, k_maxLifetime));
+            out_particleEffect->SetInitialScaleProperty(MakeRandom(CS::Vector2(0.5f, 0.5f), CS::Vector2(1.0f, 1.0f)));
+            out_particleEffect->SetInitialRotationProperty(MakeRandom(0.0f, 6.28f));
+            out_particleEffect->SetInitialSpeedProperty(MakeRandom(1.0f, 4.0f));
+            out_particleEffect->SetInitialAngularVelocityProperty(MakeRandom(-1.0f, 1.0f));
+        }
+        //----------------------------------------------------------------
+        /// Sets the affectors shared by the stream and burst scenarios:
+        /// gravity, shrinking over the lifetime of the particle and fading
+        /// out.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        //----------------------------------------------------------------
+        void SetCommonAffectors(CS::ParticleEffect* out_particleEffect)
+        {
+            std::vector<CS::ParticleAffectorDefUPtr> affectorDefs;
+            affectorDefs.push_back(CS::ParticleAffectorDefUPtr(new CS::AccelerationParticleAffectorDef(MakeConstant(CS::Vector3(0.0f, -9.8f, 0.0f)))));
+            affectorDefs.push_back(CS::ParticleAffectorDefUPtr(new CS::ScaleOverLifetimeParticleAffectorDef(MakeConstant(CS::Vector2(0.1f, 0.1f)))));
+            affectorDefs.push_back(CS::ParticleAffectorDefUPtr(new CS::ColourOverLifetimeParticleAffectorDef(MakeConstant(CS::Colour(1.0f, 1.0f, 1.0f, 0.0f)))));
+            out_particleEffect->SetAffectorDefs(std::move(affectorDefs));
+        }
+        //----------------------------------------------------------------
+        /// Builds a typical continuously emitting effect: a sphere emitter
+        /// streaming at a rate which keeps the effect close to its maximum
+        /// number of particles, with acceleration, scale and colour
+        /// affectors.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        //----------------------------------------------------------------
+        void BuildStreamEffect(CS::ParticleEffect* out_particleEffect)
+        {
+            SetCommonProperties(out_particleEffect);
+
+            const f32 emissionRate = f32(out_particleEffect->GetMaxParticles()) / (0.5f * (k_minLifetime + k_maxLifetime));
+            out_particleEffect->SetEmitterDef(CS::ParticleEmitterDefUPtr(new CS::SphereParticleEmitterDef(CS::ParticleEmitterDef::EmissionMode::k_stream, MakeConstant(emissionRate),
+                MakeConstant(1u), MakeConstant(1.0f), CS::SphereParticleEmitterDef::EmitFromType::k_inside, CS::SphereParticleEmitterDef::EmitDirectionType::k_awayFromCentre,
+                MakeConstant(1.0f))));
+
+            SetCommonAffectors(out_particleEffect);
+        }
+        //----------------------------------------------------------------
+        /// Builds an effect which emits its maximum number of particles in
+        /// a single frame, such as an explosion. The effect is slightly
+        /// longer than the particle lifetime so each burst has expired
+        /// before the next one, when the effect loops.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        //----------------------------------------------------------------
+        void BuildBurstEffect(CS::ParticleEffect* out_particleEffect)
+        {
+            SetCommonProperties(out_particleEffect);
+            out_particleEffect->SetDuration(k_maxLifetime + 0.5f);
+
+            out_particleEffect->SetEmitterDef(CS::ParticleEmitterDefUPtr(new CS::SphereParticleEmitterDef(CS::ParticleEmitterDef::EmissionMode::k_burst, MakeConstant(1.0f),
+                MakeConstant(out_particleEffect->GetMaxParticles()), MakeConstant(1.0f), CS::SphereParticleEmitterDef::EmitFromType::k_inside,
+                CS::SphereParticleEmitterDef::EmitDirectionType::k_awayFromCentre, MakeConstant(1.0f))));
+
+            SetCommonAffectors(out_particleEffect);
+        }
+        //----------------------------------------------------------------
+        /// Builds an effect with short lived particles streaming at a high
+        /// rate, which go through four intermediate colours before fading
+        /// out. Two of the intermediate colours are random, so are
+        /// generated per particle. Only the colour affector is used so its
+        /// cost can be measured on its own.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        //----------------------------------------------------------------
+        void BuildColourEffect(CS::ParticleEffect* out_particleEffect)
+        {
+            SetCommonProperties(out_particleEffect);
+            out_particleEffect->SetLifetimeProperty(MakeRandom(k_minShortLifetime, k_maxShortLifetime));
+
+            const f32 emissionRate = f32(out_particleEffect->GetMaxParticles()) / (0.5f * (k_minShortLifetime + k_maxShortLifetime));
+            out_particleEffect->SetEmitterDef(CS::ParticleEmitterDefUPtr(new CS::SphereParticleEmitterDef(CS::ParticleEmitterDef::EmissionMode::k_stream, MakeConstant(emissionRate),
+                MakeConstant(1u), MakeConstant(1.0f), CS::SphereParticleEmitterDef::EmitFromType::k_inside, CS::SphereParticleEmitterDef::EmitDirectionType::k_awayFromCentre,
+                MakeConstant(1.0f))));
+
+            std::vector<CS::ColourOverLifetimeParticleAffectorDef::IntermediateColour> intermediateColours(4);
+            intermediateColours[0].m_colourProperty = MakeConstant(CS::Colour(1.0f, 1.0f, 0.5f, 1.0f));
+            intermediateColours[0].m_timeProperty = MakeConstant(0.2f);
+            intermediateColours[1].m_colourProperty = MakeRandom(CS::Colour(1.0f, 0.5f, 0.0f, 1.0f), CS::Colour(1.0f, 0.8f, 0.2f, 1.0f));
+            intermediateColours[1].m_timeProperty = MakeConstant(0.4f);
+            intermediateColours[2].m_colourProperty = MakeRandom(CS::Colour(0.8f, 0.1f, 0.0f, 1.0f), CS::Colour(1.0f, 0.3f, 0.1f, 1.0f));
+            intermediateColours[2].m_timeProperty = MakeConstant(0.6f);
+            intermediateColours[3].m_colourProperty = MakeConstant(CS::Colour(0.3f, 0.3f, 0.3f, 0.8f));
+            intermediateColours[3].m_timeProperty = MakeConstant(0.8f);
+
+            std::vector<CS::ParticleAffectorDefUPtr> affectorDefs;
+            affectorDefs.push_back(CS::ParticleAffectorDefUPtr(new CS::ColourOverLifetimeParticleAffectorDef(MakeConstant(CS::Colour(0.3f, 0.3f, 0.3f, 0.0f)),
+                std::move(intermediateColours))));
+            out_particleEffect->SetAffectorDefs(std::move(affectorDefs));
+        }
+    }
+
+    //------------------------------------------------------------------------
+    //------------------------------------------------------------------------
+    std::vector<Scenario> CreateScenarios()
+    {
+        std::vector<Scenario> scenarios;
+
+        Scenario stream;
+        stream.m_name = "stream";
+        stream.m_description = "Sphere emitter streaming at a steady rate with acceleration, scale and colour affectors.";
+        stream.m_buildDelegate = &BuildStreamEffect;
+        scenarios.push_back(std::move(stream));
+
+        Scenario burst;
+        burst.m_name = "burst";
+        burst.m_description = "Sphere emitter bursting the maximum number of particles in a single frame, with the same affectors as stream.";
+        burst.m_buildDelegate = &BuildBurstEffect;
+        scenarios.push_back(std::move(burst));
+
+        Scenario colour;
+        colour.m_name = "colour";
+        colour.m_description = "Short lived particles streaming at a high rate through four intermediate colours.";
+        colour.m_buildDelegate = &BuildColourEffect;
+        scenarios.push_back(std::move(colour));
+
+        return scenarios;
+    }
+}
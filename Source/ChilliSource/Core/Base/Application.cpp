@@ -64,7 +64,9 @@
 #include <ChilliSource/Rendering/Material/MaterialProvider.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Rendering/Particle/CSParticleCacheProvider.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
+#include <ChilliSource/Rendering/Particle/ParticleSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDefFactory.h>
@@ -155,6 +157,12 @@ namespace ChilliSource
     }
     //----------------------------------------------------
     //----------------------------------------------------
+    f32 Application::GetUpdateIntervalRemainder() const
+    {
+        return m_updateIntervalRemainder;
+    }
+    //----------------------------------------------------
+    //----------------------------------------------------
     void Application::SetUpdateSpeed(f32 infSpeed)
     {
         m_updateSpeed = infSpeed;
@@ -342,6 +350,12 @@ namespace ChilliSource
     //----------------------------------------------------
     void Application::Destroy()
     {
+        //notify all application systems in reverse order, prior to the task scheduler being destroyed.
+        for (std::vector<AppSystemUPtr>::const_reverse_iterator it = m_systems.rbegin(); it != m_systems.rend(); ++it)
+        {
+            (*it)->OnPreDestroy();
+        }
+        
         m_taskScheduler->Destroy();
         
         OnDestroy();
@@ -405,9 +419,11 @@ namespace ChilliSource
         
         //Particles
         CreateSystem<CSParticleProvider>();
+        CreateSystem<CSParticleCacheProvider>();
         CreateSystem<ParticleAffectorDefFactory>();
         CreateSystem<ParticleDrawableDefFactory>();
         CreateSystem<ParticleEmitterDefFactory>();
+        CreateSystem<ParticleSystem>();
         
         //UI
         CreateSystem<UIComponentFactory>();
@@ -217,6 +217,20 @@ namespace ChilliSource
         //-----------------------------------------------------
         f32 GetUpdateIntervalMax() const;
         //-----------------------------------------------------
+        /// Returns the time which has elapsed since the last
+        /// fixed update but hasn't yet been processed by one.
+        /// Dividing this by the update interval gives the
+        /// fraction of the way through the current fixed
+        /// update that the frame is, which can be used to
+        /// interpolate state which is updated in fixed steps.
+        ///
+        /// @author agent
+        ///
+        /// @return The unprocessed time since the last fixed
+        /// update. This can be negative during the first frame.
+        //-----------------------------------------------------
+        f32 GetUpdateIntervalRemainder() const;
+        //-----------------------------------------------------
         /// Sets a multiplier for slowing or speeding up the
         /// delta time passed to each system and state.
         ///
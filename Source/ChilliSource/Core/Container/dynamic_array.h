@@ -57,6 +57,7 @@ namespace ChilliSource
         using const_iterator = random_access_iterator<const value_type>;
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using deleter_type = void(*)(pointer);
         
         //------------------------------------------------------------------------------
         /// Constructor. Initialises the array with the given number of elements.
@@ -67,6 +68,19 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         dynamic_array(size_type in_size);
         //------------------------------------------------------------------------------
+        /// Constructor. Takes ownership of externally allocated storage. The
+        /// elements must already have been constructed, and the deleter must both
+        /// destroy them and release the storage. This allows the array to be backed
+        /// by a custom allocator.
+        ///
+        /// @author agent
+        ///
+        /// @param The size of the array.
+        /// @param The storage containing the constructed elements.
+        /// @param The deleter used to destroy the elements and release the storage.
+        //------------------------------------------------------------------------------
+        dynamic_array(size_type in_size, pointer in_data, deleter_type in_deleter);
+        //------------------------------------------------------------------------------
         /// Move constructor.
         ///
         /// @author Nicolas Tanda
@@ -247,26 +261,41 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         const_reverse_iterator crend() const;
     private:
+        //------------------------------------------------------------------------------
+        /// The deleter used for arrays allocated with new[].
+        ///
+        /// @author agent
+        ///
+        /// @param The array to delete.
+        //------------------------------------------------------------------------------
+        static void default_delete(pointer in_array);
+
         size_type m_size;
-        std::unique_ptr<value_type[]> m_array;
+        std::unique_ptr<value_type[], deleter_type> m_array;
     };
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     template <typename TType> dynamic_array<TType>::dynamic_array(size_type in_size)
-        : m_size(in_size)
+        : m_size(in_size), m_array(nullptr, &dynamic_array<TType>::default_delete)
     {
         if(in_size > 0)
         {
-            m_array = std::unique_ptr<TType[]>(new TType[in_size]);
+            m_array.reset(new TType[in_size]);
         }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    template <typename TType> dynamic_array<TType>::dynamic_array(size_type in_size, pointer in_data, deleter_type in_deleter)
+        : m_size(in_size), m_array(in_data, in_deleter)
+    {
+        CS_ASSERT(in_deleter != nullptr, "Cannot create a dynamic array with a null deleter.");
+        CS_ASSERT(in_size == 0 || in_data != nullptr, "Cannot create a dynamic array with null storage.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     template <typename TType> dynamic_array<TType>::dynamic_array(dynamic_array<TType>&& in_dynamicArray)
+        : m_size(in_dynamicArray.m_size), m_array(std::move(in_dynamicArray.m_array))
     {
-        m_array = std::move(in_dynamicArray.m_array);
-        
-        m_size = in_dynamicArray.m_size;
         in_dynamicArray.m_size = 0;
     }
     //------------------------------------------------------------------------------
@@ -282,6 +311,12 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    template <typename TType> void dynamic_array<TType>::default_delete(pointer in_array)
+    {
+        delete[] in_array;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     template <typename TType> typename dynamic_array<TType>::size_type dynamic_array<TType>::size() const
     {
         return m_size;
@@ -126,6 +126,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Line);
     CS_FORWARDDECLARE_CLASS(Plane);
     CS_FORWARDDECLARE_CLASS(Frustum);
+    CS_FORWARDDECLARE_CLASS(FastRandom);
     CS_FORWARDDECLARE_STRUCT(UnifiedScalar);
     CS_FORWARDDECLARE_STRUCT(UnifiedVector2);
     CS_FORWARDDECLARE_STRUCT(UnifiedRectangle);
@@ -0,0 +1,166 @@
+//
+//  FastRandom.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Math/FastRandom.h>
+
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Matrix3.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        //------------------------------------------------------------------------------
+        /// The splitmix64 generator, which is used to expand a 64-bit seed into the
+        /// full generator state.
+        ///
+        /// @author agent
+        ///
+        /// @param [In/Out] The splitmix state.
+        ///
+        /// @return The next value.
+        //------------------------------------------------------------------------------
+        u64 SplitMix64(u64& inout_state)
+        {
+            u64 z = (inout_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    FastRandom::FastRandom()
+    {
+        Seed(Random::Generate<u64>());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    FastRandom::FastRandom(u64 in_seed)
+    {
+        Seed(in_seed);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void FastRandom::Seed(u64 in_seed)
+    {
+        u64 splitMixState = in_seed;
+        u64 a = SplitMix64(splitMixState);
+        u64 b = SplitMix64(splitMixState);
+
+        m_state[0] = u32(a);
+        m_state[1] = u32(a >> 32);
+        m_state[2] = u32(b);
+        m_state[3] = u32(b >> 32);
+
+        //the state must never be entirely zero.
+        if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0)
+        {
+            m_state[0] = 1;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Vector2 FastRandom::GenerateComponentwise(Vector2 in_lower, Vector2 in_upper)
+    {
+        f32 x = Generate(in_lower.x, in_upper.x);
+        f32 y = Generate(in_lower.y, in_upper.y);
+
+        return Vector2(x, y);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Vector3 FastRandom::GenerateComponentwise(Vector3 in_lower, Vector3 in_upper)
+    {
+        f32 x = Generate(in_lower.x, in_upper.x);
+        f32 y = Generate(in_lower.y, in_upper.y);
+        f32 z = Generate(in_lower.z, in_upper.z);
+
+        return Vector3(x, y, z);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Vector4 FastRandom::GenerateComponentwise(Vector4 in_lower, Vector4 in_upper)
+    {
+        f32 x = Generate(in_lower.x, in_upper.x);
+        f32 y = Generate(in_lower.y, in_upper.y);
+        f32 z = Generate(in_lower.z, in_upper.z);
+        f32 w = Generate(in_lower.w, in_upper.w);
+
+        return Vector4(x, y, z, w);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Matrix3 FastRandom::GenerateComponentwise(Matrix3 in_lower, Matrix3 in_upper)
+    {
+        Matrix3 output;
+        for (u32 i = 0; i < 9; ++i)
+        {
+            output.m[i] = Generate(in_lower.m[i], in_upper.m[i]);
+        }
+        return output;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Matrix4 FastRandom::GenerateComponentwise(Matrix4 in_lower, Matrix4 in_upper)
+    {
+        Matrix4 output;
+        for (u32 i = 0; i < 16; ++i)
+        {
+            output.m[i] = Generate(in_lower.m[i], in_upper.m[i]);
+        }
+        return output;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Quaternion FastRandom::GenerateComponentwise(Quaternion in_lower, Quaternion in_upper)
+    {
+        f32 x = Generate(in_lower.x, in_upper.x);
+        f32 y = Generate(in_lower.y, in_upper.y);
+        f32 z = Generate(in_lower.z, in_upper.z);
+        f32 w = Generate(in_lower.w, in_upper.w);
+
+        return Quaternion(x, y, z, w);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <> Colour FastRandom::GenerateComponentwise(Colour in_lower, Colour in_upper)
+    {
+        f32 r = Generate(in_lower.r, in_upper.r);
+        f32 g = Generate(in_lower.g, in_upper.g);
+        f32 b = Generate(in_lower.b, in_upper.b);
+        f32 a = Generate(in_lower.a, in_upper.a);
+
+        return Colour(r, g, b, a);
+    }
+}
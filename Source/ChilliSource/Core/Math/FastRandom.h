@@ -0,0 +1,301 @@
+//
+//  FastRandom.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_MATH_FASTRANDOM_H_
+#define _CHILLISOURCE_CORE_MATH_FASTRANDOM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A small, fast pseudo random number generator based on xoshiro128**. This
+    /// is intended for code which requires a large number of random values, such
+    /// as particle emission, where the cost of the std::mt19937 and distribution
+    /// objects used by the Random functions would be significant.
+    ///
+    /// Unlike the Random functions this is not thread-safe: each task which
+    /// requires random numbers should own its own generator. Default constructed
+    /// generators are seeded using the thread-safe Random functions, so generators
+    /// used by concurrently running tasks produce independent sequences.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    class FastRandom final
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// Constructor. Seeds the generator with a random seed.
+        ///
+        /// @author agent
+        //------------------------------------------------------------------------------
+        FastRandom();
+        //------------------------------------------------------------------------------
+        /// Constructor. Seeds the generator with the given seed. Generators created
+        /// with the same seed will produce the same sequence.
+        ///
+        /// @author agent
+        ///
+        /// @param The seed.
+        //------------------------------------------------------------------------------
+        explicit FastRandom(u64 in_seed);
+        //------------------------------------------------------------------------------
+        /// Re-seeds the generator.
+        ///
+        /// @author agent
+        ///
+        /// @param The seed.
+        //------------------------------------------------------------------------------
+        void Seed(u64 in_seed);
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The next raw 32-bit value in the sequence.
+        //------------------------------------------------------------------------------
+        u32 GenerateU32();
+        //------------------------------------------------------------------------------
+        /// Generates a value in the given range. Integer values are in the inclusive
+        /// range, floating point values are in the range [lower, upper). Any other
+        /// type is generated by interpolating between the lower and upper values
+        /// with a random normalised float. Integer types larger than 32-bits are
+        /// not supported.
+        ///
+        /// @author agent
+        ///
+        /// @param The lower value.
+        /// @param The upper value.
+        ///
+        /// @return The generated value.
+        //------------------------------------------------------------------------------
+        template <typename TType> TType Generate(TType in_lower, TType in_upper);
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return A random floating point value in the range [0.0, 1.0).
+        //------------------------------------------------------------------------------
+        template <typename TType> TType GenerateNormalised();
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return A random normalised 2D direction. This is distributed in the same
+        /// way as Random::GenerateDirection2D().
+        //------------------------------------------------------------------------------
+        template <typename TType> GenericVector2<TType> GenerateDirection2D();
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return A random normalised 3D direction. This is distributed in the same
+        /// way as Random::GenerateDirection3D().
+        //------------------------------------------------------------------------------
+        template <typename TType> GenericVector3<TType> GenerateDirection3D();
+        //------------------------------------------------------------------------------
+        /// Generates a value in the given range. If the value has multiple components
+        /// (i.e Vector2, Matrix4, Colour, etc) then each component is randomised
+        /// individually.
+        ///
+        /// @author agent
+        ///
+        /// @param The lower value.
+        /// @param The upper value.
+        ///
+        /// @return The generated value.
+        //------------------------------------------------------------------------------
+        template <typename TType> TType GenerateComponentwise(TType in_lower, TType in_upper);
+        //------------------------------------------------------------------------------
+        /// Fills the given buffer with random values in the range [0.0, 1.0).
+        ///
+        /// @author agent
+        ///
+        /// @param [Out] The output buffer.
+        /// @param The number of values to generate.
+        //------------------------------------------------------------------------------
+        void FillNormalised(f32* out_values, u32 in_numValues);
+        //------------------------------------------------------------------------------
+        /// Fills the given buffer with random values in the range [lower, upper).
+        ///
+        /// @author agent
+        ///
+        /// @param The lower value.
+        /// @param The upper value.
+        /// @param [Out] The output buffer.
+        /// @param The number of values to generate.
+        //------------------------------------------------------------------------------
+        void FillRange(f32 in_lower, f32 in_upper, f32* out_values, u32 in_numValues);
+
+    private:
+        //------------------------------------------------------------------------------
+        /// Uses template specialisation to determine which of the 3 random number
+        /// generation types should be used: Integer, Float or Generic.
+        ///
+        /// @author agent
+        //------------------------------------------------------------------------------
+        template <typename TType, bool = std::is_integral<TType>::value, bool = std::is_floating_point<TType>::value> struct Generator;
+
+        u32 m_state[4];
+    };
+
+    //------------------------------------------------------------------------------
+    /// The generic generator, which interpolates between the lower and upper
+    /// values using a random normalised float.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    template <typename TType, bool, bool> struct FastRandom::Generator
+    {
+        static TType Generate(FastRandom& inout_random, TType in_lower, TType in_upper)
+        {
+            return in_lower + (in_upper - in_lower) * inout_random.GenerateNormalised<f32>();
+        }
+    };
+    //------------------------------------------------------------------------------
+    /// The integer generator. This maps the 32-bit value onto the range using a
+    /// multiply and shift rather than a modulo.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    template <typename TType> struct FastRandom::Generator<TType, true, false>
+    {
+        static_assert(sizeof(TType) <= sizeof(u32), "Fast random cannot generate integers larger than 32-bits.");
+
+        static TType Generate(FastRandom& inout_random, TType in_lower, TType in_upper)
+        {
+            TType lower = std::min(in_lower, in_upper);
+            TType upper = std::max(in_lower, in_upper);
+
+            u64 range = u64(s64(upper) - s64(lower)) + 1;
+            return TType(s64(lower) + s64((u64(inout_random.GenerateU32()) * range) >> 32));
+        }
+    };
+    //------------------------------------------------------------------------------
+    /// The floating point generator.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    template <typename TType> struct FastRandom::Generator<TType, false, true>
+    {
+        static TType Generate(FastRandom& inout_random, TType in_lower, TType in_upper)
+        {
+            return in_lower + (in_upper - in_lower) * inout_random.GenerateNormalised<TType>();
+        }
+    };
+
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline u32 FastRandom::GenerateU32()
+    {
+        const u32 s1 = m_state[1];
+        const u32 scrambled = s1 * 5;
+        const u32 result = ((scrambled << 7) | (scrambled >> 25)) * 9;
+
+        const u32 t = s1 << 9;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = (m_state[3] << 11) | (m_state[3] >> 21);
+
+        return result;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> TType FastRandom::Generate(TType in_lower, TType in_upper)
+    {
+        return Generator<TType>::Generate(*this, in_lower, in_upper);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> TType FastRandom::GenerateNormalised()
+    {
+        static_assert(std::is_floating_point<TType>::value, "Normalised values must be floating point.");
+
+        //use the top 24 bits so that every value is exactly representable as an f32.
+        return TType(GenerateU32() >> 8) * TType(1.0 / 16777216.0);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> GenericVector2<TType> FastRandom::GenerateDirection2D()
+    {
+        GenericVector2<TType> vector(Generate(TType(-1), TType(1)), Generate(TType(-1), TType(1)));
+        vector.Normalise();
+        return vector;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> GenericVector3<TType> FastRandom::GenerateDirection3D()
+    {
+        GenericVector3<TType> vector(Generate(TType(-1), TType(1)), Generate(TType(-1), TType(1)), Generate(TType(-1), TType(1)));
+        vector.Normalise();
+        return vector;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TType> TType FastRandom::GenerateComponentwise(TType in_lower, TType in_upper)
+    {
+        return Generate(in_lower, in_upper);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline void FastRandom::FillNormalised(f32* out_values, u32 in_numValues)
+    {
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = f32(GenerateU32() >> 8) * (1.0f / 16777216.0f);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    inline void FastRandom::FillRange(f32 in_lower, f32 in_upper, f32* out_values, u32 in_numValues)
+    {
+        const f32 scale = (in_upper - in_lower) * (1.0f / 16777216.0f);
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = in_lower + f32(GenerateU32() >> 8) * scale;
+        }
+    }
+    //------------------------------------------------------------------------------
+    /// Specialisations of GenerateComponentwise() for values with multiple
+    /// components.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    template <> Vector2 FastRandom::GenerateComponentwise(Vector2 in_lower, Vector2 in_upper);
+    template <> Vector3 FastRandom::GenerateComponentwise(Vector3 in_lower, Vector3 in_upper);
+    template <> Vector4 FastRandom::GenerateComponentwise(Vector4 in_lower, Vector4 in_upper);
+    template <> Matrix3 FastRandom::GenerateComponentwise(Matrix3 in_lower, Matrix3 in_upper);
+    template <> Matrix4 FastRandom::GenerateComponentwise(Matrix4 in_lower, Matrix4 in_upper);
+    template <> Quaternion FastRandom::GenerateComponentwise(Quaternion in_lower, Quaternion in_upper);
+    template <> Colour FastRandom::GenerateComponentwise(Colour in_lower, Colour in_upper);
+}
+
+#endif
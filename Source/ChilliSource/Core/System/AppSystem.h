@@ -130,6 +130,18 @@ namespace ChilliSource
         //------------------------------------------------
         virtual void OnSuspend() {};
         //------------------------------------------------
+        /// Called when the application is about to be
+        /// destroyed, before the task scheduler is
+        /// destroyed. This should be used to finish any
+        /// tasks the system has in flight which could
+        /// schedule further tasks. System pre-destruction
+        /// occurs in the reverse order to which they
+        /// were created.
+        ///
+        /// @author agent
+        //------------------------------------------------
+        virtual void OnPreDestroy() {};
+        //------------------------------------------------
         /// Called when the application is being destroyed.
         /// This should be used to cleanup memory and
         /// references to other systems. System destruction
@@ -72,6 +72,14 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    u32 TaskScheduler::GetNumSmallTaskThreads() const noexcept
+    {
+        CS_ASSERT(m_smallTaskPool != nullptr, "Cannot get the number of small task threads before the task scheduler is initialised.");
+
+        return m_smallTaskPool->GetNumThreads();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskScheduler::ScheduleTask(TaskType in_taskType, const Task& in_task) noexcept
     {
         std::vector<Task> tasks = { in_task };
@@ -73,6 +73,15 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         bool IsMainThread() const noexcept;
         //------------------------------------------------------------------------------
+        /// This can only be called once the task scheduler has been initialised.
+        ///
+        /// @author agent
+        ///
+        /// @return The number of threads which small tasks are executed on. This is
+        /// useful for deciding how many tasks to split a large piece of work into.
+        //------------------------------------------------------------------------------
+        u32 GetNumSmallTaskThreads() const noexcept;
+        //------------------------------------------------------------------------------
         /// Schedules a single task which will be executed in a manner dependant on the
         /// task type.
         ///
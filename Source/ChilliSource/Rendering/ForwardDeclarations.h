@@ -112,12 +112,19 @@ namespace ChilliSource
     //------------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(ConcurrentParticleData);
     CS_FORWARDDECLARE_CLASS(CSParticleProvider);
+    CS_FORWARDDECLARE_CLASS(CSParticleCacheProvider);
     CS_FORWARDDECLARE_CLASS(ParticleEffect);
     CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
-    CS_FORWARDDECLARE_STRUCT(Particle);
+    CS_FORWARDDECLARE_CLASS(ParticleEffectPool);
+    CS_FORWARDDECLARE_CLASS(ParticleArray);
+    CS_FORWARDDECLARE_CLASS(ParticleMemoryManager);
+    CS_FORWARDDECLARE_CLASS(ParticleSystem);
+    CS_FORWARDDECLARE_CLASS(ParticleSimulationCache);
+    CS_FORWARDDECLARE_CLASS(ParticleStats);
     CS_FORWARDDECLARE_CLASS(ParticleDrawable);
     CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
     CS_FORWARDDECLARE_CLASS(ParticleDrawableDefFactory);
+    CS_FORWARDDECLARE_CLASS(ParticleVertexBuilder);
     CS_FORWARDDECLARE_CLASS(ParticleEmitter);
     CS_FORWARDDECLARE_CLASS(ParticleEmitterDef);
     CS_FORWARDDECLARE_CLASS(ParticleEmitterDefFactory);
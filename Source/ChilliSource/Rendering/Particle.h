@@ -30,11 +30,18 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Particle/CSParticleCacheProvider.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffectPool.h>
+#include <ChilliSource/Rendering/Particle/ParticleIntegration.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
+#include <ChilliSource/Rendering/Particle/ParticleStats.h>
+#include <ChilliSource/Rendering/Particle/ParticleSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
@@ -46,11 +53,14 @@
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawable.h>
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawableDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleQuadBuffer.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleVertexBuilder.h>
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitterDef.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitter.h>
@@ -65,6 +75,7 @@
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitterDef.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/ComponentwiseRandomConstantParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/ConstantParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/RandomConstantParticleProperty.h>
@@ -29,16 +29,17 @@
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->size())
+    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->GetMemoryManager()->AllocateArray<Vector3>(in_particleArray->GetCapacity()))
     {
         //This can only be created by the AccelerationParticleAffectorDef so this is safe.
         m_accelerationAffectorDef = static_cast<const AccelerationParticleAffectorDef*>(in_affectorDef);
@@ -49,19 +50,27 @@ namespace ChilliSource
     {
         CS_ASSERT(in_index >= 0 && in_index < m_particleAcceleration.size(), "Index out of bounds!");
 
-        m_particleAcceleration[in_index] = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+        m_particleAcceleration[in_index] = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress, GetRandom());
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+    void AccelerationParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
-        {
-            Particle& particle = particleArray->at(i);
-            Vector3& acceleration = m_particleAcceleration[i];
+        CS_ASSERT(in_fromIndex < m_particleAcceleration.size() && in_toIndex < m_particleAcceleration.size(), "Index out of bounds!");
 
-            particle.m_velocity += acceleration * in_deltaTime;
+        m_particleAcceleration[in_toIndex] = m_particleAcceleration[in_fromIndex];
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end)
+    {
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_start <= in_end && in_end <= particleArray->GetNumActiveParticles(), "Particle range out of bounds.");
+
+        dynamic_array<Vector3>& velocities = particleArray->GetVelocities();
+        for (u32 i = in_start; i < in_end; ++i)
+        {
+            velocities[i] += m_particleAcceleration[i] * in_deltaTime;
         }
     }
 }
\ No newline at end of file
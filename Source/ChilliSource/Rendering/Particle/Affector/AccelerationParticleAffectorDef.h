@@ -99,7 +99,7 @@ namespace ChilliSource
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleAffectorUPtr CreateInstance(ParticleArray* in_particleArray) const override;
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -29,16 +29,17 @@
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.h>
 
 namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->size())
+    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->GetMemoryManager()->AllocateArray<f32>(in_particleArray->GetCapacity()))
     {
         //This can only be created by the AngularAccelerationParticleAffectorDef so this is safe.
         m_angularAccelerationAffectorDef = static_cast<const AngularAccelerationParticleAffectorDef*>(in_affectorDef);
@@ -49,18 +50,27 @@ namespace ChilliSource
     {
         CS_ASSERT(in_index >= 0 && in_index < m_particleAngularAcceleration.size(), "Index out of bounds!");
 
-        m_particleAngularAcceleration[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress);
+        m_particleAngularAcceleration[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress, GetRandom());
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+    void AngularAccelerationParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        CS_ASSERT(in_fromIndex < m_particleAngularAcceleration.size() && in_toIndex < m_particleAngularAcceleration.size(), "Index out of bounds!");
+
+        m_particleAngularAcceleration[in_toIndex] = m_particleAngularAcceleration[in_fromIndex];
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end)
+    {
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_start <= in_end && in_end <= particleArray->GetNumActiveParticles(), "Particle range out of bounds.");
+
+        dynamic_array<f32>& angularVelocities = particleArray->GetAngularVelocities();
+        for (u32 i = in_start; i < in_end; ++i)
         {
-            Particle& particle = particleArray->at(i);
-            f32 angularAcceleration = m_particleAngularAcceleration[i];
-            particle.m_angularVelocity += angularAcceleration * in_deltaTime;
+            angularVelocities[i] += m_particleAngularAcceleration[i] * in_deltaTime;
         }
     }
 }
\ No newline at end of file
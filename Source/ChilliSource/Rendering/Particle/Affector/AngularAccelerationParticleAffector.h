@@ -56,6 +56,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
         //----------------------------------------------------------------
+        /// Moves the angular acceleration of a particle from one index to another.
+        ///
+        /// @author agent
+        ///
+        /// @param The index the particle was moved from.
+        /// @param The index the particle was moved to.
+        //----------------------------------------------------------------
+        void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+        //----------------------------------------------------------------
         /// Angularly accelerates each active particle.
         ///
         /// @author Ian Copland
@@ -63,8 +72,10 @@ namespace ChilliSource
         /// @param The delta time.
         /// @param The current normalised (0.0 to 1.0) progress through
         /// playback of the particle effect.
+        /// @param The index of the first particle to affect.
+        /// @param The index after the last particle to affect.
         //----------------------------------------------------------------
-        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end) override;
         //----------------------------------------------------------------
         /// Destructor
         ///
@@ -81,7 +92,7 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
 
         const AngularAccelerationParticleAffectorDef* m_angularAccelerationAffectorDef = nullptr;
         dynamic_array<f32> m_particleAngularAcceleration;
@@ -29,10 +29,13 @@
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace
@@ -52,85 +55,122 @@ namespace ChilliSource
     
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
+    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
     :ParticleAffector(in_affectorDef, in_particleArray)
     ,m_particleColourData(0)
+    ,m_particleSegments(in_particleArray->GetMemoryManager()->AllocateArray<u32>(in_particleArray->GetCapacity()))
     {
         m_colourOverLifetimeAffectorDef = static_cast<const ColourOverLifetimeParticleAffectorDef*>(in_affectorDef);
         m_intermediateParticles = static_cast<u32>(m_colourOverLifetimeAffectorDef->GetIntermediateColours().size());
-        m_particleColourData = std::move(dynamic_array<ColourData>(in_particleArray->size() * (2 + m_intermediateParticles)));
+        m_particleColourData = in_particleArray->GetMemoryManager()->AllocateArray<ColourData>(in_particleArray->GetCapacity() * (2 + m_intermediateParticles));
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ColourOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        u32 colourDataIndex = in_index * (2 + m_intermediateParticles);
-        CS_ASSERT(colourDataIndex >= 0 && colourDataIndex < m_particleColourData.size(), "colourDataIndex out of bounds!");
-        
-        ColourData& colourDataInitial = m_particleColourData[colourDataIndex];
-        const Particle& particle = GetParticleArray()->at(in_index);
-        
-        colourDataInitial.m_time = 0.0f;
-        colourDataInitial.m_colour = particle.m_colour;
-        ++colourDataIndex;
-        
-        // Get the intermediate colours
-        std::vector<ColourData> intermediateColours;
-        intermediateColours.reserve(m_intermediateParticles);
-        for(const auto& intermediateColour : m_colourOverLifetimeAffectorDef->GetIntermediateColours())
+        const u32 coloursPerParticle = 2 + m_intermediateParticles;
+        CS_ASSERT((in_index + 1) * coloursPerParticle <= m_particleColourData.size(), "Index out of bounds!");
+
+        ColourData* colourData = &m_particleColourData[in_index * coloursPerParticle];
+        colourData[0].m_time = 0.0f;
+        colourData[0].m_colour = GetParticleArray()->GetColours()[in_index];
+
+        // Generate the intermediate colours, insertion sorting them by time as they are added.
+        const auto& intermediateColours = m_colourOverLifetimeAffectorDef->GetIntermediateColours();
+        for (u32 i = 0; i < m_intermediateParticles; ++i)
         {
-            intermediateColours.push_back(ColourData());
-            intermediateColours.back().m_colour = intermediateColour.m_colourProperty->GenerateValue(in_effectProgress);
-            intermediateColours.back().m_time = intermediateColour.m_timeProperty->GenerateValue(in_effectProgress);
+            ColourData intermediateColour;
+            intermediateColour.m_colour = intermediateColours[i].m_colourProperty->GenerateValue(in_effectProgress, GetRandom());
+            intermediateColour.m_time = intermediateColours[i].m_timeProperty->GenerateValue(in_effectProgress, GetRandom());
+
+            u32 insertIndex = i + 1;
+            while (insertIndex > 1 && colourData[insertIndex - 1].m_time > intermediateColour.m_time)
+            {
+                colourData[insertIndex] = colourData[insertIndex - 1];
+                --insertIndex;
+            }
+            colourData[insertIndex] = intermediateColour;
         }
-        
-        // Sort by time
-        std::sort(intermediateColours.begin(), intermediateColours.end(), [](const ColourData& in_r, const ColourData& in_l)-> bool
-        {
-            return in_r.m_time < in_l.m_time;
-        });
-        
-        // Add to the particles colour data
-        for(const auto& intermediateColour : intermediateColours)
+
+        colourData[coloursPerParticle - 1].m_time = 1.0f;
+        colourData[coloursPerParticle - 1].m_colour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress, GetRandom());
+
+        m_particleSegments[in_index] = 0;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ColourOverLifetimeParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+    {
+        const u32 coloursPerParticle = 2 + m_intermediateParticles;
+        CS_ASSERT((in_fromIndex + 1) * coloursPerParticle <= m_particleColourData.size() && (in_toIndex + 1) * coloursPerParticle <= m_particleColourData.size(), "Index out of bounds!");
+
+        for (u32 offset = 0; offset < coloursPerParticle; ++offset)
         {
-            ColourData& colourDataIntermediate = m_particleColourData[colourDataIndex];
-            colourDataIntermediate = intermediateColour;
-            ++colourDataIndex;
+            m_particleColourData[in_toIndex * coloursPerParticle + offset] = m_particleColourData[in_fromIndex * coloursPerParticle + offset];
         }
-        
-        ColourData& colourDataTarget = m_particleColourData[colourDataIndex];
-        colourDataTarget.m_time = 1.0f;
-        colourDataTarget.m_colour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+
+        m_particleSegments[in_toIndex] = m_particleSegments[in_fromIndex];
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void ColourOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+    void ColourOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end)
     {
         const auto& interpolation = m_colourOverLifetimeAffectorDef->GetInterpolation();
         
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_start <= in_end && in_end <= particleArray->GetNumActiveParticles(), "Particle range out of bounds.");
+
+        const dynamic_array<f32>& energies = particleArray->GetEnergies();
+        const dynamic_array<f32>& lifetimes = particleArray->GetLifetimes();
+        dynamic_array<Colour>& colours = particleArray->GetColours();
+
+        const u32 coloursPerParticle = 2 + m_intermediateParticles;
+        const u32 lastSegment = coloursPerParticle - 2;
+
+        const u32 k_maxBatchSize = 64;
+        f32 lifeProgress[k_maxBatchSize];
+        f32 interpolatedProgress[k_maxBatchSize];
+
+        for (u32 batchStart = in_start; batchStart < in_end; batchStart += k_maxBatchSize)
         {
-            Particle& particle = particleArray->at(i);
-            
-            if(particle.m_isActive == false)
+            const u32 batchSize = std::min(k_maxBatchSize, in_end - batchStart);
+            for (u32 i = 0; i < batchSize; ++i)
             {
-                continue;
+                lifeProgress[i] = 1.0f - (energies[batchStart + i] / lifetimes[batchStart + i]);
             }
-            
-            u32 colourIndex = i * (2 + m_intermediateParticles);
-            ColourData& colourDataInitial = m_particleColourData[colourIndex];
-
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            f32 progress = interpolation(normalisedLifeProgress);
-            
-            particle.m_colour = colourDataInitial.m_colour;
-            for(u32 offset = 0; offset < m_intermediateParticles + 1; ++offset)
+
+            interpolation.Evaluate(lifeProgress, batchSize, interpolatedProgress);
+
+            for (u32 i = 0; i < batchSize; ++i)
             {
-                ColourData& colourData = m_particleColourData[colourIndex + offset];
-                ColourData& colourDataNext = m_particleColourData[colourIndex + offset + 1];
-                f32 timeProgress = Clamp(Clamp(progress - colourData.m_time) / (colourDataNext.m_time - colourData.m_time));
-                particle.m_colour += (colourDataNext.m_colour - colourData.m_colour) * timeProgress;
+                const u32 particleIndex = batchStart + i;
+                const ColourData* colourData = &m_particleColourData[particleIndex * coloursPerParticle];
+                const f32 progress = interpolatedProgress[i];
+
+                // Progress usually only moves forward, so start from the previous segment. It can move
+                // backwards with a ping pong interpolation curve so both directions are handled.
+                u32 segment = m_particleSegments[particleIndex];
+                while (segment < lastSegment && progress >= colourData[segment + 1].m_time)
+                {
+                    ++segment;
+                }
+                while (segment > 0 && progress < colourData[segment].m_time)
+                {
+                    --segment;
+                }
+                m_particleSegments[particleIndex] = segment;
+
+                const ColourData& segmentStart = colourData[segment];
+                const ColourData& segmentEnd = colourData[segment + 1];
+                const f32 segmentLength = segmentEnd.m_time - segmentStart.m_time;
+
+                f32 segmentProgress = 1.0f;
+                if (segmentLength > 0.0f)
+                {
+                    segmentProgress = Clamp((progress - segmentStart.m_time) / segmentLength);
+                }
+
+                colours[particleIndex] = segmentStart.m_colour + (segmentEnd.m_colour - segmentStart.m_colour) * segmentProgress;
             }
         }
     }
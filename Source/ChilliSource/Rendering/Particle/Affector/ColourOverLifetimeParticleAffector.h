@@ -48,7 +48,8 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// Stores the initial colour and generates a target colour for the
         /// activated particle so it can be used to generate the 
-        /// interpolated colour during updates.
+        /// interpolated colour during updates. The intermediate colours
+        /// are sorted by time in place, so this doesn't allocate.
         ///
         /// @author Ian Copland
         ///
@@ -58,15 +59,28 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
         //----------------------------------------------------------------
-        /// Updates the colour of each particle.
+        /// Moves the colour data of a particle from one index to another.
+        ///
+        /// @author agent
+        ///
+        /// @param The index the particle was moved from.
+        /// @param The index the particle was moved to.
+        //----------------------------------------------------------------
+        void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+        //----------------------------------------------------------------
+        /// Updates the colour of each particle. Each particle remembers
+        /// the colour segment it was last in, so only the current segment
+        /// is evaluated rather than every segment.
         ///
         /// @author Ian Copland
         ///
         /// @param The delta time.
         /// @param The current normalised (0.0 to 1.0) progress through
         /// playback of the particle effect.
+        /// @param The index of the first particle to affect.
+        /// @param The index after the last particle to affect.
         //----------------------------------------------------------------
-        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end) override;
         //----------------------------------------------------------------
         /// Destructor
         ///
@@ -94,11 +108,12 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         
     private:
         const ColourOverLifetimeParticleAffectorDef* m_colourOverLifetimeAffectorDef = nullptr;
         dynamic_array<ColourData> m_particleColourData;
+        dynamic_array<u32> m_particleSegments;
         
         u32 m_intermediateParticles = 0;
     };
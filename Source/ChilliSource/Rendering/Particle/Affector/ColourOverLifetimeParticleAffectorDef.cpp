@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
+#include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticlePropertyFactory.h>
 
@@ -41,6 +42,7 @@ namespace ChilliSource
         const char k_timeProperty[] = "TimeProperty";
         
         const char k_interpolationKey[] = "Interpolation";
+        const char k_interpolationResolutionKey[] = "InterpolationResolution";
         const char k_defaultInterpolation[] = "Linear";
     }
     
@@ -64,13 +66,14 @@ namespace ChilliSource
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     ColourOverLifetimeParticleAffectorDef::ColourOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Colour> in_targetColour, std::vector<IntermediateColour> in_intermediateColours,
-        const std::function<f32(f32)>& in_interpolation)
+        const ParticleCurve& in_interpolation)
         : m_targetColourProperty(std::move(in_targetColour)), m_intermediateColours(std::move(in_intermediateColours)), m_interpolation(in_interpolation)
     {
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     ColourOverLifetimeParticleAffectorDef::ColourOverLifetimeParticleAffectorDef(const Json::Value& in_paramsJson, const LoadedDelegate& in_asyncDelegate)
+        : m_interpolation(ParticleCurve::Type::k_linear)
     {
         // Target Colour
         const auto& jsonValue = in_paramsJson.get(k_targetColourProperty, Json::nullValue);
@@ -93,7 +96,14 @@ namespace ChilliSource
         
         // Curve
         auto interpolationName = in_paramsJson.get(k_interpolationKey, k_defaultInterpolation).asString();
-        m_interpolation = Interpolate::GetInterpolateFunction(interpolationName);
+        m_interpolation = ParticleCurve(interpolationName);
+        
+        const auto& jsonResolution = in_paramsJson.get(k_interpolationResolutionKey, Json::nullValue);
+        if (jsonResolution.isNull() == false)
+        {
+            CS_ASSERT(jsonResolution.isString(), "'" + std::string(k_interpolationResolutionKey) + "' must be a string.");
+            m_interpolation.Bake(ParseU32(jsonResolution.asString()));
+        }
 
         // Call the loaded delegate if required.
         if (in_asyncDelegate != nullptr)
@@ -109,7 +119,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr ColourOverLifetimeParticleAffectorDef::CreateInstance(ParticleArray* in_particleArray) const
     {
         return ParticleAffectorUPtr(new ColourOverLifetimeParticleAffector(this, in_particleArray));
     }
@@ -121,7 +131,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    const std::function<f32(f32)>& ColourOverLifetimeParticleAffectorDef::GetInterpolation() const
+    const ParticleCurve& ColourOverLifetimeParticleAffectorDef::GetInterpolation() const
     {
         return m_interpolation;
     }
@@ -32,8 +32,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
-#include <ChilliSource/Core/Math/Interpolate.h>
 
 #include <json/json.h>
 
@@ -61,6 +61,9 @@ namespace ChilliSource
     /// "Interpolation": The interpolation curve used to transition from one
     /// colour to another.
     ///
+    /// "InterpolationResolution": [Optional] If supplied, the interpolation
+    /// curve is baked into a lookup table with this number of samples.
+    ///
     /// @author Nicolas Tanda
     //------------------------------------------------------------------------------
     class ColourOverLifetimeParticleAffectorDef final : public ParticleAffectorDef
@@ -107,11 +110,11 @@ namespace ChilliSource
         /// to.
         /// @param in_intermediateColours - [Optional] Intermediate colours to transition
         /// to between the initial and target colours. 
-        /// @param in_interpolation - [Optional] The function used for interpolation
+        /// @param in_interpolation - [Optional] The curve used for interpolation
         /// between colours. Defaults to linear interpolation.
         //------------------------------------------------------------------------------
         ColourOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Colour> in_targetColour, std::vector<IntermediateColour> in_intermediateColours = std::vector<IntermediateColour>(), 
-            const std::function<f32(f32)>& in_interpolation = Interpolate::Linear);
+            const ParticleCurve& in_interpolation = ParticleCurve::Type::k_linear);
         //------------------------------------------------------------------------------
         /// Constructor. Loads the params for the affector def from the given param 
         /// dictionary. If the async delegate is not null, then any resource loading 
@@ -147,7 +150,7 @@ namespace ChilliSource
         ///
         /// @return the instance.
         //------------------------------------------------------------------------------
-        ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleAffectorUPtr CreateInstance(ParticleArray* in_particleArray) const override;
         //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -157,9 +160,9 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
-        /// @return The interpolation function used to transition between colours.
+        /// @return The interpolation curve used to transition between colours.
         //------------------------------------------------------------------------------
-        const std::function<f32(f32)>& GetInterpolation() const;
+        const ParticleCurve& GetInterpolation() const;
         //------------------------------------------------------------------------------
         /// @author Nicolas Tanda
         ///
@@ -174,7 +177,7 @@ namespace ChilliSource
         virtual ~ColourOverLifetimeParticleAffectorDef() {}
         
     private:
-        std::function<f32(f32)> m_interpolation;
+        ParticleCurve m_interpolation;
         ParticlePropertyUPtr<Colour> m_targetColourProperty;
         
         std::vector<IntermediateColour> m_intermediateColours;
@@ -32,7 +32,7 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
+    ParticleAffector::ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
         : m_affectorDef(in_affectorDef), m_particleArray(in_particleArray)
     {
     }
@@ -44,8 +44,14 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    dynamic_array<Particle>* ParticleAffector::GetParticleArray() const
+    ParticleArray* ParticleAffector::GetParticleArray() const
     {
         return m_particleArray;
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    FastRandom& ParticleAffector::GetRandom()
+    {
+        return m_random;
+    }
 }
\ No newline at end of file
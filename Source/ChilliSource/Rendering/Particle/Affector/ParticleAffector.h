@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_AFFECTOR_PARTICLEAFFECTOR_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 
 namespace ChilliSource
 {
@@ -53,7 +54,7 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         //----------------------------------------------------------------
         /// Activates the particle with the given index.
         ///
@@ -67,17 +68,38 @@ namespace ChilliSource
         //----------------------------------------------------------------
         virtual void ActivateParticle(u32 in_index, f32 in_effectProgress) = 0;
         //----------------------------------------------------------------
-        /// Applies the affect to each of the active particles.
+        /// Moves any per-particle data from one index to another. This is
+        /// called when a particle is removed and the last active particle
+        /// is moved into its place to keep the active particles densely
+        /// packed. The data at the source index is no longer needed.
         ///
         /// This will be called on a background thread.
         ///
+        /// @author agent
+        ///
+        /// @param The index the particle was moved from.
+        /// @param The index the particle was moved to.
+        //----------------------------------------------------------------
+        virtual void MoveParticle(u32 in_fromIndex, u32 in_toIndex) = 0;
+        //----------------------------------------------------------------
+        /// Applies the affect to each of the active particles in the given
+        /// range. The active particles are always the first 
+        /// GetNumActiveParticles() entries in the particle array.
+        ///
+        /// This will be called on a background thread. Large effects may
+        /// be split into several disjoint ranges which are affected
+        /// concurrently, so only data for particles within the range
+        /// should be accessed.
+        ///
         /// @author Ian Copland
         ///
         /// @param The delta time.
         /// @param The current normalised (0.0 to 1.0) progress through
         /// playback of the particle effect.
+        /// @param The index of the first particle to affect.
+        /// @param The index after the last particle to affect.
         //----------------------------------------------------------------
-        virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) = 0;
+        virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end) = 0;
         //----------------------------------------------------------------
         /// Destructor
         ///
@@ -96,11 +118,23 @@ namespace ChilliSource
         ///
         /// @return The particle array.
         //----------------------------------------------------------------
-        dynamic_array<Particle>* GetParticleArray() const;
+        ParticleArray* GetParticleArray() const;
+        //----------------------------------------------------------------
+        /// The affector's own random number generator. This is seeded
+        /// independently for each affector and is only used from within
+        /// the affector's update, so can be used without synchronisation
+        /// while activating particles.
+        ///
+        /// @author agent
+        ///
+        /// @return The random number generator.
+        //----------------------------------------------------------------
+        FastRandom& GetRandom();
     private:
 
         const ParticleAffectorDef* m_affectorDef = nullptr;
-        dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleArray* m_particleArray = nullptr;
+        FastRandom m_random;
     };
 }
 
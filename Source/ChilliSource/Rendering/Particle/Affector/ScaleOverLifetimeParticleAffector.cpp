@@ -29,16 +29,19 @@
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->size())
+    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->GetMemoryManager()->AllocateArray<ScaleData>(in_particleArray->GetCapacity()))
     {
         //This can only be created by the ScaleOverLifetimeParticleAffectorDef so this is safe.
         m_scaleOverLifetimeAffectorDef = static_cast<const ScaleOverLifetimeParticleAffectorDef*>(in_affectorDef);
@@ -50,24 +53,50 @@ namespace ChilliSource
         CS_ASSERT(in_index >= 0 && in_index < m_particleScaleData.size(), "Index out of bounds!");
 
         ScaleData& scaleData = m_particleScaleData[in_index];
-        const Particle& particle = GetParticleArray()->at(in_index);
-        
-        scaleData.m_initialScale = particle.m_scale;
+        scaleData.m_initialScale = GetParticleArray()->GetScales()[in_index];
+
+        scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress, GetRandom());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ScaleOverLifetimeParticleAffector::MoveParticle(u32 in_fromIndex, u32 in_toIndex)
+    {
+        CS_ASSERT(in_fromIndex < m_particleScaleData.size() && in_toIndex < m_particleScaleData.size(), "Index out of bounds!");
 
-        scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
+        m_particleScaleData[in_toIndex] = m_particleScaleData[in_fromIndex];
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
+    void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_start <= in_end && in_end <= particleArray->GetNumActiveParticles(), "Particle range out of bounds.");
+
+        const dynamic_array<f32>& energies = particleArray->GetEnergies();
+        const dynamic_array<f32>& lifetimes = particleArray->GetLifetimes();
+        dynamic_array<Vector2>& scales = particleArray->GetScales();
+
+        const ParticleCurve& interpolation = m_scaleOverLifetimeAffectorDef->GetInterpolation();
+
+        const u32 k_maxBatchSize = 64;
+        f32 lifeProgress[k_maxBatchSize];
+        f32 interpolatedProgress[k_maxBatchSize];
+
+        for (u32 batchStart = in_start; batchStart < in_end; batchStart += k_maxBatchSize)
         {
-            Particle& particle = particleArray->at(i);
-            ScaleData& scaleData = m_particleScaleData[i];
+            const u32 batchSize = std::min(k_maxBatchSize, in_end - batchStart);
+            for (u32 i = 0; i < batchSize; ++i)
+            {
+                lifeProgress[i] = 1.0f - (energies[batchStart + i] / lifetimes[batchStart + i]);
+            }
+
+            interpolation.Evaluate(lifeProgress, batchSize, interpolatedProgress);
 
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
+            for (u32 i = 0; i < batchSize; ++i)
+            {
+                const ScaleData& scaleData = m_particleScaleData[batchStart + i];
+                scales[batchStart + i] = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * interpolatedProgress[i];
+            }
         }
     }
 }
\ No newline at end of file
@@ -58,6 +58,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void ActivateParticle(u32 in_index, f32 in_effectProgress) override;
         //----------------------------------------------------------------
+        /// Moves the scale data of a particle from one index to another.
+        ///
+        /// @author agent
+        ///
+        /// @param The index the particle was moved from.
+        /// @param The index the particle was moved to.
+        //----------------------------------------------------------------
+        void MoveParticle(u32 in_fromIndex, u32 in_toIndex) override;
+        //----------------------------------------------------------------
         /// Updates the size of each particle.
         ///
         /// @author Ian Copland
@@ -65,8 +74,10 @@ namespace ChilliSource
         /// @param The delta time.
         /// @param The current normalised (0.0 to 1.0) progress through
         /// playback of the particle effect.
+        /// @param The index of the first particle to affect.
+        /// @param The index after the last particle to affect.
         //----------------------------------------------------------------
-        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
+        void AffectParticles(f32 in_deltaTime, f32 in_effectProgress, u32 in_start, u32 in_end) override;
         //----------------------------------------------------------------
         /// Destructor
         ///
@@ -83,7 +94,7 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         //----------------------------------------------------------------
         /// A container for the initial scale and scale factor of a single 
         /// particle.
@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
+#include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticlePropertyFactory.h>
 
@@ -36,19 +37,35 @@ namespace ChilliSource
     CS_DEFINE_NAMEDTYPE(ScaleOverLifetimeParticleAffectorDef);
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ScaleOverLifetimeParticleAffectorDef::ScaleOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Vector2> in_scaleProperty)
-        : m_scaleProperty(std::move(in_scaleProperty))
+    ScaleOverLifetimeParticleAffectorDef::ScaleOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Vector2> in_scaleProperty, const ParticleCurve& in_interpolation)
+        : m_scaleProperty(std::move(in_scaleProperty)), m_interpolation(in_interpolation)
     {
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     ScaleOverLifetimeParticleAffectorDef::ScaleOverLifetimeParticleAffectorDef(const Json::Value& in_paramsJson, const LoadedDelegate& in_asyncDelegate)
+        : m_interpolation(ParticleCurve::Type::k_linear)
     {
         //scale
         Json::Value jsonValue = in_paramsJson.get("ScaleProperty", Json::nullValue);
         CS_ASSERT(jsonValue.isNull() == false, "No scale property provided.");
         m_scaleProperty = ParticlePropertyFactory::CreateProperty<Vector2>(jsonValue);
 
+        //interpolation
+        jsonValue = in_paramsJson.get("Interpolation", Json::nullValue);
+        if (jsonValue.isNull() == false)
+        {
+            CS_ASSERT(jsonValue.isString(), "'Interpolation' must be a string.");
+            m_interpolation = ParticleCurve(jsonValue.asString());
+        }
+
+        jsonValue = in_paramsJson.get("InterpolationResolution", Json::nullValue);
+        if (jsonValue.isNull() == false)
+        {
+            CS_ASSERT(jsonValue.isString(), "'InterpolationResolution' must be a string.");
+            m_interpolation.Bake(ParseU32(jsonValue.asString()));
+        }
+
         //call the loaded delegate if required.
         if (in_asyncDelegate != nullptr)
         {
@@ -63,7 +80,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleAffectorUPtr ScaleOverLifetimeParticleAffectorDef::CreateInstance(ParticleArray* in_particleArray) const
     {
         return ParticleAffectorUPtr(new ScaleOverLifetimeParticleAffector(this, in_particleArray));
     }
@@ -73,4 +90,10 @@ namespace ChilliSource
     {
         return m_scaleProperty.get();
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const ParticleCurve& ScaleOverLifetimeParticleAffectorDef::GetInterpolation() const
+    {
+        return m_interpolation;
+    }
 }
\ No newline at end of file
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
 
 #include <json/json.h>
@@ -48,6 +49,12 @@ namespace ChilliSource
     ///
     /// "ScaleProperty": The property describing the scale factor. 
     ///
+    /// "Interpolation": [Optional] The interpolation curve used to transition
+    /// from the initial to the target scale. Defaults to linear.
+    ///
+    /// "InterpolationResolution": [Optional] If supplied, the interpolation
+    /// curve is baked into a lookup table with this number of samples.
+    ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
     class ScaleOverLifetimeParticleAffectorDef final : public ParticleAffectorDef
@@ -60,8 +67,10 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The property which describes the scale factor.
+        /// @param [Optional] The curve used for interpolation between the
+        /// initial and target scale. Defaults to linear interpolation.
         //----------------------------------------------------------------
-        ScaleOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Vector2> in_scaleProperty);
+        ScaleOverLifetimeParticleAffectorDef(ParticlePropertyUPtr<Vector2> in_scaleProperty, const ParticleCurve& in_interpolation = ParticleCurve::Type::k_linear);
         //----------------------------------------------------------------
         /// Constructor. Loads the params for the affector def from the 
         /// given param dictionary. If the async delegate is not null, then
@@ -98,7 +107,7 @@ namespace ChilliSource
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        ParticleAffectorUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleAffectorUPtr CreateInstance(ParticleArray* in_particleArray) const override;
         //----------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -106,6 +115,13 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const ParticleProperty<Vector2>* GetScaleProperty() const;
         //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The interpolation curve used to transition between the
+        /// initial and target scale.
+        //----------------------------------------------------------------
+        const ParticleCurve& GetInterpolation() const;
+        //----------------------------------------------------------------
         /// Destructor
         ///
         /// @author Ian Copland.
@@ -114,6 +130,7 @@ namespace ChilliSource
     private:
 
         ParticlePropertyUPtr<Vector2> m_scaleProperty;
+        ParticleCurve m_interpolation;
     };
 }
 
@@ -0,0 +1,141 @@
+//
+//  CSParticleCacheProvider.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/CSParticleCacheProvider.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        const std::string k_fileExtension = "csparticlecache";
+
+        //-----------------------------------------------------------------
+        /// Reads the CSParticleCache file and populates the simulation
+        /// cache. The file contents are used as the cache data as is.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location of the file.
+        /// @param The file path.
+        /// @param [Out] The simulation cache that should be populated.
+        //-----------------------------------------------------------------
+        void LoadCSParticleCache(StorageLocation in_storageLocation, const std::string& in_filePath, const ParticleSimulationCacheSPtr& out_simulationCache)
+        {
+            FileStreamUPtr fileStream = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
+            if (fileStream == nullptr)
+            {
+                CS_LOG_ERROR("Could not open CSParticleCache file: " + in_filePath);
+                out_simulationCache->SetLoadState(Resource::LoadState::k_failed);
+                return;
+            }
+
+            fileStream->SeekG(0, SeekDir::k_end);
+            const s32 fileSize = fileStream->TellG();
+            fileStream->SeekG(0, SeekDir::k_beginning);
+
+            if (fileSize <= 0)
+            {
+                CS_LOG_ERROR("CSParticleCache file is empty: " + in_filePath);
+                out_simulationCache->SetLoadState(Resource::LoadState::k_failed);
+                return;
+            }
+
+            std::unique_ptr<u8[]> data(new u8[fileSize]);
+            fileStream->Read(reinterpret_cast<s8*>(data.get()), fileSize);
+
+            out_simulationCache->Build(std::unique_ptr<const u8[]>(data.release()), u32(fileSize));
+            out_simulationCache->SetLoadState(Resource::LoadState::k_loaded);
+        }
+    }
+
+    CS_DEFINE_NAMEDTYPE(CSParticleCacheProvider);
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    CSParticleCacheProviderUPtr CSParticleCacheProvider::Create()
+    {
+        return CSParticleCacheProviderUPtr(new CSParticleCacheProvider());
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    bool CSParticleCacheProvider::IsA(InterfaceIDType in_interfaceId) const
+    {
+        return (ResourceProvider::InterfaceID == in_interfaceId || CSParticleCacheProvider::InterfaceID == in_interfaceId);
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    InterfaceIDType CSParticleCacheProvider::GetResourceType() const
+    {
+        return ParticleSimulationCache::InterfaceID;
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    bool CSParticleCacheProvider::CanCreateResourceWithFileExtension(const std::string& in_extension) const
+    {
+        std::string lowerExtension = in_extension;
+        StringUtils::ToLowerCase(lowerExtension);
+        return (lowerExtension == k_fileExtension);
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    void CSParticleCacheProvider::CreateResourceFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, 
+        const ResourceSPtr& out_resource)
+    {
+        CS_ASSERT(out_resource != nullptr, "resource cannot be null.");
+        CS_ASSERT(out_resource->IsA<ParticleSimulationCache>() == true, "resource must be a particle simulation cache.");
+
+        ParticleSimulationCacheSPtr simulationCache = std::static_pointer_cast<ParticleSimulationCache>(out_resource);
+        LoadCSParticleCache(in_location, in_filePath, simulationCache);
+    }
+    //-----------------------------------------------------------------
+    //------------------------------------------------------------------
+    void CSParticleCacheProvider::CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, 
+        const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
+    {
+        CS_ASSERT(out_resource != nullptr, "resource cannot be null.");
+        CS_ASSERT(out_resource->IsA<ParticleSimulationCache>() == true, "resource must be a particle simulation cache."); 
+        CS_ASSERT(in_delegate != nullptr, "Async load delegate cannot be null.");
+
+        ParticleSimulationCacheSPtr simulationCache = std::static_pointer_cast<ParticleSimulationCache>(out_resource);
+        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        {
+            LoadCSParticleCache(in_location, in_filePath, simulationCache);
+            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                in_delegate(simulationCache);
+            });
+        });
+    }
+}
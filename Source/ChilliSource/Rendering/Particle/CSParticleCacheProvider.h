@@ -0,0 +1,128 @@
+//
+//  CSParticleCacheProvider.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_CSPARTICLECACHEPROVIDER_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_CSPARTICLECACHEPROVIDER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/ResourceProvider.h>
+
+namespace ChilliSource
+{
+    //-------------------------------------------------------------------------
+    /// A resource provider which creates Particle Simulation Cache resources
+    /// from CSParticleCache files. The file contents are used directly as
+    /// the cache data.
+    ///
+    /// @author agent
+    //-------------------------------------------------------------------------
+    class CSParticleCacheProvider final : public ResourceProvider
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(CSParticleCacheProvider);
+        //-----------------------------------------------------------------
+        /// Allows querying of whether or not this implements the interface
+        /// described by the given interface Id.
+        /// 
+        /// @author agent
+        ///
+        /// @param The interface Id.
+        ///
+        /// @return Whether this implements the interface.
+        //-----------------------------------------------------------------
+        bool IsA(InterfaceIDType in_interfaceId) const override;
+        //-----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The type of resource loaded by this provider.
+        //-----------------------------------------------------------------
+        InterfaceIDType GetResourceType() const override;
+        //-----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The extension to check.
+        ///
+        /// @return Whether or not this can load from files with the
+        /// given extension.
+        //-----------------------------------------------------------------
+        bool CanCreateResourceWithFileExtension(const std::string& in_extension) const override;
+    private:
+        friend class Application;
+        //-----------------------------------------------------------------
+        /// Factory method for creating new instances of this system.
+        ///
+        /// @author agent
+        ///
+        /// @return The instance of this system.
+        //-----------------------------------------------------------------
+        static CSParticleCacheProviderUPtr Create();
+        //-----------------------------------------------------------------
+        /// Default constructor. Declared private to force the use of the
+        /// CreateSystem() method in Application.
+        ///
+        /// @author agent
+        //-----------------------------------------------------------------
+        CSParticleCacheProvider() = default;
+        //-----------------------------------------------------------------
+        /// Populates the given Particle Simulation Cache resource with data
+        /// from the given file. The resource should be checked to ensure it
+        /// has loaded after this method is called.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location of the file.
+        /// @param The file path.
+        /// @param The resource options. This is always empty for a
+        /// simulation cache.
+        /// @param [Out] The output simulation cache resource.
+        //-----------------------------------------------------------------
+        void CreateResourceFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, 
+            const ResourceSPtr& out_resource) override;
+        //-----------------------------------------------------------------
+        /// Populates the given Particle Simulation Cache resource with data
+        /// from the given file. The loading is performed as a background
+        /// task, the resource should not be used until the completion
+        /// delegate has been called. When the completion delegate is
+        /// called the resource should be checked to confirm it has
+        /// successfully loaded.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location of the file.
+        /// @param The file path.
+        /// @param The resource options. This is always empty for a
+        /// simulation cache.
+        /// @param The completion delegate. This should never be null.
+        /// @param [Out] Resource object
+        //------------------------------------------------------------------
+        void CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, 
+            const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource) override;
+    };
+}
+
+#endif
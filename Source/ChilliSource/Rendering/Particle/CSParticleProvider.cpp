@@ -29,6 +29,9 @@
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
+#include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Json/JsonUtils.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
@@ -45,6 +48,25 @@ namespace ChilliSource
     namespace
     {
         const std::string k_fileExtension = "csparticle";
+        const std::string k_binaryFileExtension = "csparticlebin";
+        const u32 k_fileFormatId = 2;
+        const u32 k_fileFormatVersion = 1;
+        //-----------------------------------------------------------------
+        /// The type tags used for each value in the compiled json tree
+        /// stored in the DEFS chunk of a binary csparticle file.
+        ///
+        /// @author agent
+        //-----------------------------------------------------------------
+        enum class CompiledJsonType : u8
+        {
+            k_null,
+            k_bool,
+            k_int,
+            k_real,
+            k_string,
+            k_array,
+            k_object
+        };
         //-----------------------------------------------------------------
         /// A delegate called when one of the asynchronous loading stages 
         /// has completed.
@@ -79,6 +101,179 @@ namespace ChilliSource
             return ParticleEffect::SimulationSpace::k_world;
         }
         //-----------------------------------------------------------------
+        /// Parses a priority string value.
+        ///
+        /// @author agent
+        ///
+        /// @param The string value.
+        ///
+        /// @return The priority described by the string.
+        //-----------------------------------------------------------------
+        ParticleEffect::Priority ParsePriority(const std::string& in_string)
+        {
+            std::string priorityString = in_string;
+            StringUtils::ToLowerCase(priorityString);
+
+            if (priorityString == "low")
+            {
+                return ParticleEffect::Priority::k_low;
+            }
+            else if (priorityString == "normal")
+            {
+                return ParticleEffect::Priority::k_normal;
+            }
+            else if (priorityString == "high")
+            {
+                return ParticleEffect::Priority::k_high;
+            }
+
+            CS_LOG_FATAL("Invalid priority in particle effect: " + in_string);
+            return ParticleEffect::Priority::k_normal;
+        }
+        //-----------------------------------------------------------------
+        /// Parses a lod metric string value.
+        ///
+        /// @author agent
+        ///
+        /// @param The string value.
+        ///
+        /// @return The lod metric described by the string.
+        //-----------------------------------------------------------------
+        ParticleEffect::LodMetric ParseLodMetric(const std::string& in_string)
+        {
+            std::string lodMetricString = in_string;
+            StringUtils::ToLowerCase(lodMetricString);
+
+            if (lodMetricString == "distance")
+            {
+                return ParticleEffect::LodMetric::k_distance;
+            }
+            else if (lodMetricString == "projectedsize")
+            {
+                return ParticleEffect::LodMetric::k_projectedSize;
+            }
+
+            CS_LOG_FATAL("Invalid lod metric in particle effect: " + in_string);
+            return ParticleEffect::LodMetric::k_distance;
+        }
+        //-----------------------------------------------------------------
+        /// Reads the optional level of detail bands from the csparticle
+        /// json.
+        ///
+        /// @author agent
+        ///
+        /// @param The root json object
+        /// @param [Out] The particle effect that should be populated.
+        //-----------------------------------------------------------------
+        void ReadLodBands(const Json::Value& in_jsonRoot, const ParticleEffectSPtr& out_particleEffect)
+        {
+            ParticleEffect::LodMetric lodMetric = ParticleEffect::LodMetric::k_distance;
+            Json::Value jsonValue = in_jsonRoot.get("LodMetric", Json::nullValue);
+            if (jsonValue.isNull() == false)
+            {
+                CS_ASSERT(jsonValue.isString(), "LodMetric value must be a string.");
+                lodMetric = ParseLodMetric(jsonValue.asString());
+            }
+
+            jsonValue = in_jsonRoot.get("LodBands", Json::nullValue);
+            if (jsonValue.isNull() == false)
+            {
+                CS_ASSERT(jsonValue.isArray(), "LodBands value must be an array.");
+
+                std::vector<ParticleEffect::LodBand> lodBands;
+                for (const Json::Value& lodBandJson : jsonValue)
+                {
+                    CS_ASSERT(lodBandJson.isObject(), "Lod band must be an object.");
+
+                    ParticleEffect::LodBand lodBand;
+                    for (auto it = lodBandJson.begin(); it != lodBandJson.end(); ++it)
+                    {
+                        CS_ASSERT((*it).isString(), "All values in a lod band must be strings.");
+
+                        const std::string key = it.memberName();
+                        const std::string value = (*it).asString();
+                        if (key == "Threshold")
+                        {
+                            lodBand.m_threshold = ParseF32(value);
+                        }
+                        else if (key == "EmissionRateScale")
+                        {
+                            lodBand.m_emissionRateScale = ParseF32(value);
+                        }
+                        else if (key == "MaxParticlesScale")
+                        {
+                            lodBand.m_maxParticlesScale = ParseF32(value);
+                        }
+                        else if (key == "UpdateInterval")
+                        {
+                            lodBand.m_updateInterval = ParseU32(value);
+                        }
+                        else
+                        {
+                            CS_LOG_FATAL("Unknown key in lod band: " + key);
+                        }
+                    }
+
+                    lodBands.push_back(lodBand);
+                }
+
+                out_particleEffect->SetLodBands(lodMetric, std::move(lodBands));
+            }
+        }
+        //-----------------------------------------------------------------
+        /// Reads the optional predicted bounds from the particle effect
+        /// json. These are ignored for effects simulated in world space.
+        ///
+        /// @author agent
+        ///
+        /// @param The root json object
+        /// @param [Out] The particle effect that should be populated.
+        //-----------------------------------------------------------------
+        void ReadPredictedBounds(const Json::Value& in_jsonRoot, const ParticleEffectSPtr& out_particleEffect)
+        {
+            Json::Value jsonValue = in_jsonRoot.get("PredictedBounds", Json::nullValue);
+            if (jsonValue.isNull() == true)
+            {
+                return;
+            }
+
+            CS_ASSERT(jsonValue.isObject(), "PredictedBounds value must be an object.");
+
+            f32 emitterExtent = 0.0f;
+            f32 maxSpeed = 0.0f;
+            f32 maxLifetime = 0.0f;
+            for (auto it = jsonValue.begin(); it != jsonValue.end(); ++it)
+            {
+                CS_ASSERT((*it).isString(), "All values in predicted bounds must be strings.");
+
+                const std::string key = it.memberName();
+                const std::string value = (*it).asString();
+                if (key == "EmitterExtent")
+                {
+                    emitterExtent = ParseF32(value);
+                }
+                else if (key == "MaxSpeed")
+                {
+                    maxSpeed = ParseF32(value);
+                }
+                else if (key == "MaxLifetime")
+                {
+                    maxLifetime = ParseF32(value);
+                }
+                else
+                {
+                    CS_LOG_FATAL("Unknown key in predicted bounds: " + key);
+                }
+            }
+
+            if (out_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world)
+            {
+                CS_LOG_WARNING("Predicted bounds are ignored for particle effects simulated in world space.");
+            }
+
+            out_particleEffect->SetPredictedBounds(emitterExtent, maxSpeed, maxLifetime);
+        }
+        //-----------------------------------------------------------------
         /// Reads the base properties in the particle effect such as the
         /// effect duration, the number of particles and the initial
         /// particle values.
@@ -100,6 +295,14 @@ namespace ChilliSource
                 out_particleEffect->SetDuration(ParseF32(jsonValue.asString()));
             }
 
+            //Prewarm Duration
+            jsonValue = in_jsonRoot.get("PrewarmDuration", Json::nullValue);
+            if (jsonValue.isNull() == false)
+            {
+                CS_ASSERT(jsonValue.isString(), "Prewarm duration value must be a string.");
+                out_particleEffect->SetPrewarmDuration(ParseF32(jsonValue.asString()));
+            }
+
             //Max Particles
             jsonValue = in_jsonRoot.get("MaxParticles", Json::nullValue);
             if (jsonValue.isNull() == false)
@@ -116,6 +319,20 @@ namespace ChilliSource
                 out_particleEffect->SetSimulationSpace(ParseSimulationSpace(jsonValue.asString()));
             }
 
+            //Priority
+            jsonValue = in_jsonRoot.get("Priority", Json::nullValue);
+            if (jsonValue.isNull() == false)
+            {
+                CS_ASSERT(jsonValue.isString(), "Priority value must be a string.");
+                out_particleEffect->SetPriority(ParsePriority(jsonValue.asString()));
+            }
+
+            //Level of detail
+            ReadLodBands(in_jsonRoot, out_particleEffect);
+
+            //Predicted Bounds
+            ReadPredictedBounds(in_jsonRoot, out_particleEffect);
+
             //Lifetime Property
             jsonValue = in_jsonRoot.get("LifetimeProperty", Json::nullValue);
             if (jsonValue.isNull() == false)
@@ -165,6 +382,318 @@ namespace ChilliSource
             }
         }
         //-----------------------------------------------------------------
+        /// Reads the contents of the INFO chunk in a binary csparticle
+        /// file. This contains the effect level values such as the
+        /// duration, the number of particles and the level of detail
+        /// bands.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The INFO binary chunk.
+        /// @param [Out] The particle effect that should be populated.
+        ///
+        /// @return Whether or not the read was successful.
+        //-----------------------------------------------------------------
+        bool ReadINFOChunk(CSBinaryChunk* in_chunk, const ParticleEffectSPtr& out_particleEffect)
+        {
+            CS_ASSERT(in_chunk != nullptr, "INFO chunk cannot be null.");
+
+            out_particleEffect->SetDuration(in_chunk->Read<f32>());
+            out_particleEffect->SetPrewarmDuration(in_chunk->Read<f32>());
+            out_particleEffect->SetMaxParticles(in_chunk->Read<u32>());
+            out_particleEffect->SetSimulationSpace(static_cast<ParticleEffect::SimulationSpace>(in_chunk->Read<u8>()));
+            out_particleEffect->SetPriority(static_cast<ParticleEffect::Priority>(in_chunk->Read<u8>()));
+
+            const bool hasPredictedBounds = (in_chunk->Read<u8>() != 0);
+            const f32 emitterExtent = in_chunk->Read<f32>();
+            const f32 maxSpeed = in_chunk->Read<f32>();
+            const f32 maxLifetime = in_chunk->Read<f32>();
+            if (hasPredictedBounds == true)
+            {
+                out_particleEffect->SetPredictedBounds(emitterExtent, maxSpeed, maxLifetime);
+            }
+
+            const ParticleEffect::LodMetric lodMetric = static_cast<ParticleEffect::LodMetric>(in_chunk->Read<u8>());
+            const u32 numLodBands = in_chunk->Read<u32>();
+            if (numLodBands > 0)
+            {
+                std::vector<ParticleEffect::LodBand> lodBands(numLodBands);
+                for (auto& lodBand : lodBands)
+                {
+                    lodBand.m_threshold = in_chunk->Read<f32>();
+                    lodBand.m_emissionRateScale = in_chunk->Read<f32>();
+                    lodBand.m_maxParticlesScale = in_chunk->Read<f32>();
+                    lodBand.m_updateInterval = in_chunk->Read<u32>();
+                }
+
+                out_particleEffect->SetLodBands(lodMetric, std::move(lodBands));
+            }
+
+            CS_ASSERT(in_chunk->GetReadPosition() == in_chunk->GetSize(), "INFO chunk is the wrong size.");
+            return (in_chunk->GetReadPosition() == in_chunk->GetSize());
+        }
+        //-----------------------------------------------------------------
+        /// Reads the contents of the PROP chunk in a binary csparticle
+        /// file. This contains the initial particle value properties, in
+        /// a fixed order, each preceded by a flag describing whether or
+        /// not the property is present.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The PROP binary chunk.
+        /// @param [Out] The particle effect that should be populated.
+        ///
+        /// @return Whether or not the read was successful.
+        //-----------------------------------------------------------------
+        bool ReadPROPChunk(CSBinaryChunk* in_chunk, const ParticleEffectSPtr& out_particleEffect)
+        {
+            CS_ASSERT(in_chunk != nullptr, "PROP chunk cannot be null.");
+
+            //Lifetime Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetLifetimeProperty(ParticlePropertyFactory::CreateProperty<f32>(in_chunk));
+            }
+
+            //Initial Scale Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetInitialScaleProperty(ParticlePropertyFactory::CreateProperty<Vector2>(in_chunk));
+            }
+
+            //Initial Rotation Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetInitialRotationProperty(ParticlePropertyFactory::CreateProperty<f32>(in_chunk));
+            }
+
+            //Initial Colour Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetInitialColourProperty(ParticlePropertyFactory::CreateProperty<Colour>(in_chunk));
+            }
+
+            //Initial Speed Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetInitialSpeedProperty(ParticlePropertyFactory::CreateProperty<f32>(in_chunk));
+            }
+
+            //Initial Angular Velocity Property
+            if (in_chunk->Read<u8>() != 0)
+            {
+                out_particleEffect->SetInitialAngularVelocityProperty(ParticlePropertyFactory::CreateProperty<f32>(in_chunk));
+            }
+
+            CS_ASSERT(in_chunk->GetReadPosition() == in_chunk->GetSize(), "PROP chunk is the wrong size.");
+            return (in_chunk->GetReadPosition() == in_chunk->GetSize());
+        }
+        //-----------------------------------------------------------------
+        /// Reads a string from a binary chunk. Strings are stored as a u32
+        /// length followed by the characters.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The binary chunk.
+        ///
+        /// @return The string.
+        //-----------------------------------------------------------------
+        std::string ReadString(CSBinaryChunk* in_chunk)
+        {
+            const u32 length = in_chunk->Read<u32>();
+            const u8* characters = in_chunk->Read(length);
+            return std::string(reinterpret_cast<const s8*>(characters), length);
+        }
+        //-----------------------------------------------------------------
+        /// Reads a compiled json value from a binary chunk. Each value is
+        /// stored as a u8 type tag followed by the value. Arrays and
+        /// objects are stored as a u32 count followed by the values, with
+        /// each object value preceded by its key.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The binary chunk.
+        ///
+        /// @return The json value.
+        //-----------------------------------------------------------------
+        Json::Value ReadCompiledJson(CSBinaryChunk* in_chunk)
+        {
+            const CompiledJsonType type = static_cast<CompiledJsonType>(in_chunk->Read<u8>());
+            switch (type)
+            {
+                case CompiledJsonType::k_null:
+                {
+                    return Json::Value(Json::nullValue);
+                }
+                case CompiledJsonType::k_bool:
+                {
+                    return Json::Value(in_chunk->Read<u8>() != 0);
+                }
+                case CompiledJsonType::k_int:
+                {
+                    return Json::Value(Json::Int(in_chunk->Read<s32>()));
+                }
+                case CompiledJsonType::k_real:
+                {
+                    return Json::Value(in_chunk->Read<f64>());
+                }
+                case CompiledJsonType::k_string:
+                {
+                    return Json::Value(ReadString(in_chunk));
+                }
+                case CompiledJsonType::k_array:
+                {
+                    Json::Value output(Json::arrayValue);
+                    const u32 count = in_chunk->Read<u32>();
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        output.append(ReadCompiledJson(in_chunk));
+                    }
+                    return output;
+                }
+                case CompiledJsonType::k_object:
+                {
+                    Json::Value output(Json::objectValue);
+                    const u32 count = in_chunk->Read<u32>();
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        const std::string key = ReadString(in_chunk);
+                        output[key] = ReadCompiledJson(in_chunk);
+                    }
+                    return output;
+                }
+            }
+
+            CS_LOG_FATAL("Invalid compiled json value in csparticle file.");
+            return Json::Value(Json::nullValue);
+        }
+        //-----------------------------------------------------------------
+        /// Reads the contents of the DEFS chunk in a binary csparticle
+        /// file. This contains the drawable, emitter and affector defs as
+        /// a compiled json tree. The defs are kept as json, rather than
+        /// being compiled further, as the def factories can be extended
+        /// with user defined types which are created from json.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The DEFS binary chunk.
+        /// @param [Out] The json object containing the defs.
+        ///
+        /// @return Whether or not the read was successful.
+        //-----------------------------------------------------------------
+        bool ReadDEFSChunk(CSBinaryChunk* in_chunk, Json::Value& out_defsJson)
+        {
+            CS_ASSERT(in_chunk != nullptr, "DEFS chunk cannot be null.");
+
+            out_defsJson = ReadCompiledJson(in_chunk);
+
+            CS_ASSERT(out_defsJson.isObject() == true, "DEFS chunk must contain an object.");
+            CS_ASSERT(in_chunk->GetReadPosition() == in_chunk->GetSize(), "DEFS chunk is the wrong size.");
+            return (out_defsJson.isObject() == true && in_chunk->GetReadPosition() == in_chunk->GetSize());
+        }
+        //-----------------------------------------------------------------
+        /// Reads a binary csparticle file, as produced by the csparticle
+        /// converter tool. The effect level values and properties are read
+        /// directly into the particle effect, while the json for the defs
+        /// is output so they can be created with the def factories.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location of the binary csparticle file.
+        /// @param The file path to the binary csparticle file.
+        /// @param [Out] The particle effect that should be populated.
+        /// @param [Out] The json object containing the defs.
+        ///
+        /// @return Whether or not the read was successful.
+        //-----------------------------------------------------------------
+        bool ReadCSParticleBinary(StorageLocation in_storageLocation, const std::string& in_filePath, const ParticleEffectSPtr& out_particleEffect, Json::Value& out_defsJson)
+        {
+            CSBinaryInputStream stream(in_storageLocation, in_filePath);
+            if (stream.IsValid() == false || stream.GetFileFormatId() != k_fileFormatId || stream.GetFileFormatVersion() != k_fileFormatVersion)
+            {
+                CS_LOG_ERROR("Could not open binary csparticle file: " + in_filePath);
+                return false;
+            }
+
+            CSBinaryChunkUPtr chunk = stream.ReadChunk("INFO");
+            if (chunk == nullptr || ReadINFOChunk(chunk.get(), out_particleEffect) == false)
+            {
+                CS_LOG_ERROR("Could not read INFO chunk in binary csparticle file: " + in_filePath);
+                return false;
+            }
+
+            chunk = stream.ReadChunk("PROP");
+            if (chunk == nullptr || ReadPROPChunk(chunk.get(), out_particleEffect) == false)
+            {
+                CS_LOG_ERROR("Could not read PROP chunk in binary csparticle file: " + in_filePath);
+                return false;
+            }
+
+            chunk = stream.ReadChunk("DEFS");
+            if (chunk == nullptr || ReadDEFSChunk(chunk.get(), out_defsJson) == false)
+            {
+                CS_LOG_ERROR("Could not read DEFS chunk in binary csparticle file: " + in_filePath);
+                return false;
+            }
+
+            return true;
+        }
+        //-----------------------------------------------------------------
+        /// Reads either a json or binary csparticle file, populating the
+        /// base values of the particle effect and outputting the json
+        /// containing the defs. If a json csparticle file is requested and
+        /// a binary csparticle file with the same name exists in the same
+        /// storage location, the binary file is read instead.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location of the csparticle file.
+        /// @param The file path to the csparticle file.
+        /// @param [Out] The particle effect that should be populated.
+        /// @param [Out] The json object containing the defs.
+        ///
+        /// @return Whether or not the read was successful.
+        //-----------------------------------------------------------------
+        bool ReadCSParticle(StorageLocation in_storageLocation, const std::string& in_filePath, const ParticleEffectSPtr& out_particleEffect, Json::Value& out_defsJson)
+        {
+            std::string basePath, extension;
+            StringUtils::SplitBaseFilename(in_filePath, basePath, extension);
+            StringUtils::ToLowerCase(extension);
+
+            if (extension == k_binaryFileExtension)
+            {
+                return ReadCSParticleBinary(in_storageLocation, in_filePath, out_particleEffect, out_defsJson);
+            }
+
+            const std::string binaryFilePath = basePath + "." + k_binaryFileExtension;
+            if (Application::Get()->GetFileSystem()->DoesFileExist(in_storageLocation, binaryFilePath) == true)
+            {
+                return ReadCSParticleBinary(in_storageLocation, binaryFilePath, out_particleEffect, out_defsJson);
+            }
+
+            if (JsonUtils::ReadJson(in_storageLocation, in_filePath, out_defsJson) == false)
+            {
+                return false;
+            }
+
+            ReadBaseValues(out_defsJson, out_particleEffect);
+            return true;
+        }
+        //-----------------------------------------------------------------
         /// Reads the drawable def from the csparticle json.
         ///
         /// This is not thread safe and must be run on the main thread.
@@ -242,15 +771,15 @@ namespace ChilliSource
             }
         }
         //-----------------------------------------------------------------
-        /// Reads the CSParticle json file and populates the particle effect.
+        /// Reads the CSParticle file and populates the particle effect.
         ///
         /// This is not thread safe and must be run on the main thread.
         /// LoadCSParticleAsync() should be used for background loading.
         ///
         /// @author Ian Copland
         ///
-        /// @param The storage location of the csparticle json file.
-        /// @param The file path to the csparticle json file.
+        /// @param The storage location of the csparticle file.
+        /// @param The file path to the csparticle file.
         /// @param The particle drawable def factory.
         /// @param The particle emitter def factory.
         /// @param The particle affector def factory.
@@ -260,13 +789,12 @@ namespace ChilliSource
             const ParticleEmitterDefFactory* in_emitterDefFactory, const ParticleAffectorDefFactory* in_affectorDefFactory, const ParticleEffectSPtr& out_particleEffect)
         {
             Json::Value jsonRoot;
-            if (JsonUtils::ReadJson(in_storageLocation, in_filePath, jsonRoot) == false)
+            if (ReadCSParticle(in_storageLocation, in_filePath, out_particleEffect, jsonRoot) == false)
             {
                 out_particleEffect->SetLoadState(Resource::LoadState::k_failed);
                 return;
             }
 
-            ReadBaseValues(jsonRoot, out_particleEffect);
             ReadDrawableDef(jsonRoot, in_drawableDefFactory, out_particleEffect);
             ReadEmitterDef(jsonRoot, in_emitterDefFactory, out_particleEffect);
             ReadAffectorDefs(jsonRoot, in_affectorDefFactory, out_particleEffect);
@@ -396,13 +924,13 @@ namespace ChilliSource
             }
         }
         //-----------------------------------------------------------------
-        /// Asynchonously Reads the CSParticle json file and populates the 
+        /// Asynchonously Reads the CSParticle file and populates the 
         /// particle effect.
         ///
         /// @author Ian Copland
         ///
-        /// @param The storage location of the csparticle json file.
-        /// @param The file path to the csparticle json file.
+        /// @param The storage location of the csparticle file.
+        /// @param The file path to the csparticle file.
         /// @param The particle drawable def factory.
         /// @param The particle emitter def factory.
         /// @param The particle affector def factory.
@@ -413,7 +941,7 @@ namespace ChilliSource
             const ParticleEffectSPtr& out_particleEffect)
         {
             Json::Value jsonRoot;
-            if (JsonUtils::ReadJson(in_storageLocation, in_filePath, jsonRoot) == false)
+            if (ReadCSParticle(in_storageLocation, in_filePath, out_particleEffect, jsonRoot) == false)
             {
                 out_particleEffect->SetLoadState(Resource::LoadState::k_failed);
                 Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
@@ -423,8 +951,6 @@ namespace ChilliSource
                 return;
             }
 
-            ReadBaseValues(jsonRoot, out_particleEffect);
-
             ReadDrawableDefAsync(jsonRoot, in_drawableDefFactory, out_particleEffect, [=]()
             {
                 ReadEmitterDefAsync(jsonRoot, in_emitterDefFactory, out_particleEffect, [=]()
@@ -467,7 +993,7 @@ namespace ChilliSource
     {
         std::string lowerExtension = in_extension;
         StringUtils::ToLowerCase(lowerExtension);
-        return (lowerExtension == k_fileExtension);
+        return (lowerExtension == k_fileExtension || lowerExtension == k_binaryFileExtension);
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
@@ -36,7 +36,10 @@ namespace ChilliSource
 {
     //-------------------------------------------------------------------------
     /// A resource provider which creates Particle Effect resources from
-    /// CSParticle files.
+    /// CSParticle files. These can either be json, as authored, or binary,
+    /// as output by the csparticle converter tool. If a json file is
+    /// requested and a binary file with the same name exists alongside it,
+    /// the binary file is loaded instead.
     ///
     /// @author Ian Copland
     //-------------------------------------------------------------------------
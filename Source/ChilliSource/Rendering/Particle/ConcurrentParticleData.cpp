@@ -28,109 +28,192 @@
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_numBuffers = 3;
+        constexpr u32 k_bufferIndexMask = 0x3;
+        constexpr u32 k_newDataFlag = 0x4;
+    }
+
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    ConcurrentParticleData::VertexData::VertexData()
+        : m_vertices(0), m_batches(0)
+    {
+    }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount)
-        : m_particles(in_particleCount), m_lock(m_mutex, std::defer_lock)
+    ConcurrentParticleData::Buffer::Buffer(u32 in_particleCount, ParticleMemoryManager* in_memoryManager)
+        : m_particles(in_memoryManager->AllocateArray<ConcurrentParticleData::Particle>(in_particleCount))
     {
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
+    ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount, ParticleMemoryManager* in_memoryManager)
+        : m_memoryManager(in_memoryManager), m_writeIndex(0), m_readIndex(2), m_publishedState(1), m_updating(false)
+    {
+        CS_ASSERT(m_memoryManager != nullptr, "Cannot create concurrent particle data with a null memory manager.");
+
+        m_buffers.reserve(k_numBuffers);
+        for (u32 i = 0; i < k_numBuffers; ++i)
+        {
+            m_buffers.emplace_back(in_particleCount, m_memoryManager);
+        }
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    ParticleMemoryManager* ConcurrentParticleData::GetMemoryManager() const
+    {
+        return m_memoryManager;
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
     bool ConcurrentParticleData::StartUpdate()
     {
-        std::unique_lock<std::recursive_mutex> lock(m_mutex);
-        if (m_updating == false)
+        bool expected = false;
+        return m_updating.compare_exchange_strong(expected, true, std::memory_order_acquire);
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    bool ConcurrentParticleData::FetchCommittedData()
+    {
+        if ((m_publishedState.load(std::memory_order_relaxed) & k_newDataFlag) == 0)
         {
-            m_updating = true;
-            return true;
+            return false;
         }
 
-        return false;
+        //only the main thread clears the flag, so the exchange is guaranteed to return the new data.
+        u32 previousState = m_publishedState.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previousState & k_bufferIndexMask;
+        return true;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
     bool ConcurrentParticleData::HasActiveParticles() const
     {
-        std::unique_lock<std::recursive_mutex> lock(m_mutex);
-        return m_activeParticles;
+        return (m_buffers[m_readIndex].m_numParticles > 0);
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
     AABB ConcurrentParticleData::GetAABB() const
     {
-        std::unique_lock<std::recursive_mutex> lock(m_mutex);
-        return m_aabb;
+        return m_buffers[m_readIndex].m_aabb;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
     Sphere ConcurrentParticleData::GetBoundingSphere() const
     {
-        std::unique_lock<std::recursive_mutex> lock(m_mutex);
-        return m_boundingSphere;
+        return m_buffers[m_readIndex].m_boundingSphere;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    void ConcurrentParticleData::Lock() const
+    u32 ConcurrentParticleData::GetNumParticles() const
     {
-        m_lock.lock();
+        return m_buffers[m_readIndex].m_numParticles;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    std::vector<u32> ConcurrentParticleData::TakeNewIndices()
+    const dynamic_array<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
     {
-        CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when taking new indices!")
-
-        std::vector<u32> output = m_newParticleIndices;
-        m_newParticleIndices.clear();
-        return output;
+        return m_buffers[m_readIndex].m_particles;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    const dynamic_array<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
+    const ConcurrentParticleData::VertexData& ConcurrentParticleData::GetVertexData() const
     {
-        CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when getting particles!");
-
-        return m_particles;
+        return m_buffers[m_readIndex].m_vertexData;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    void ConcurrentParticleData::Unlock() const
+    ConcurrentParticleData::VertexData* ConcurrentParticleData::GetUncommittedVertexData()
     {
-        m_lock.unlock();
+        CS_ASSERT(m_updating.load(std::memory_order_relaxed) == true, "Cannot write vertex data without starting an update.");
+
+        Buffer& buffer = m_buffers[m_writeIndex];
+
+        const u32 numBatches = (u32(buffer.m_particles.size()) + ParticleBillboardExpansion::k_maxBatchSize - 1) / ParticleBillboardExpansion::k_maxBatchSize;
+        if (buffer.m_vertexData.m_batches.size() != numBatches)
+        {
+            buffer.m_vertexData.m_vertices = m_memoryManager->AllocateArray<SpriteBatch::SpriteVertex>(buffer.m_particles.size() * k_numSpriteVerts);
+            buffer.m_vertexData.m_batches = m_memoryManager->AllocateArray<ParticleBillboardExpansion::Batch>(numBatches);
+        }
+
+        m_vertexDataWritten = true;
+        return &buffer.m_vertexData;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    void ConcurrentParticleData::CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere)
+    void ConcurrentParticleData::CommitParticleData(const ParticleArray* in_particles, const AABB& in_aabb, const Sphere& in_boundingSphere)
     {
-        std::unique_lock<std::recursive_mutex> lock(m_mutex);
+        CS_ASSERT(m_updating.load(std::memory_order_relaxed) == true, "Cannot commit particle data without starting an update.");
+
+        Buffer& buffer = m_buffers[m_writeIndex];
 
-        CS_ASSERT(in_particles->size() == m_particles.size(), "Particle data lists must be the same size.");
+        CS_ASSERT(in_particles->GetCapacity() == buffer.m_particles.size(), "Particle data lists must be the same size.");
 
-        m_activeParticles = false;
-        for (u32 i = 0; i < m_particles.size(); ++i)
+        const dynamic_array<u32>& slotIndices = in_particles->GetSlotIndices();
+        const dynamic_array<u32>& slotGenerations = in_particles->GetSlotGenerations();
+        const dynamic_array<Vector3>& positions = in_particles->GetPositions();
+        const dynamic_array<Vector3>& previousPositions = in_particles->GetPreviousPositions();
+        const dynamic_array<f32>& rotations = in_particles->GetRotations();
+        const dynamic_array<Vector2>& scales = in_particles->GetScales();
+        const dynamic_array<Colour>& colours = in_particles->GetColours();
+
+        buffer.m_numParticles = in_particles->GetNumActiveParticles();
+        for (u32 i = 0; i < buffer.m_numParticles; ++i)
         {
-            Particle& concurrentParticle = m_particles[i];
-            const ChilliSource::Particle& particle = (*in_particles)[i];
-
-            concurrentParticle.m_isActive = particle.m_isActive;
-            concurrentParticle.m_position = particle.m_position;
-            concurrentParticle.m_rotation = particle.m_rotation;
-            concurrentParticle.m_scale = particle.m_scale;
-            concurrentParticle.m_colour = particle.m_colour;
-
-            if (concurrentParticle.m_isActive == true)
-            {
-                m_activeParticles = true;
-            }
+            Particle& concurrentParticle = buffer.m_particles[i];
+
+            concurrentParticle.m_slotIndex = slotIndices[i];
+            concurrentParticle.m_slotGeneration = slotGenerations[slotIndices[i]];
+            concurrentParticle.m_position = positions[i];
+            concurrentParticle.m_previousPosition = previousPositions[i];
+            concurrentParticle.m_rotation = rotations[i];
+            concurrentParticle.m_scale = scales[i];
+            concurrentParticle.m_colour = colours[i];
         }
 
-        m_newParticleIndices.insert(m_newParticleIndices.end(), in_newIndices.begin(), in_newIndices.end());
-        m_aabb = in_aabb;
-        m_boundingSphere = in_boundingSphere;
-        m_updating = false;
+        buffer.m_aabb = in_aabb;
+        buffer.m_boundingSphere = in_boundingSphere;
+        buffer.m_vertexData.m_isBuilt = m_vertexDataWritten;
+
+        PublishBackBuffer();
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    void ConcurrentParticleData::CommitCachedParticleData(const ParticleSimulationCache* in_simulationCache, u32 in_frameIndex)
+    {
+        CS_ASSERT(m_updating.load(std::memory_order_relaxed) == true, "Cannot commit particle data without starting an update.");
+        CS_ASSERT(in_simulationCache != nullptr, "Cannot commit particle data from a null simulation cache.");
+
+        Buffer& buffer = m_buffers[m_writeIndex];
+
+        CS_ASSERT(in_simulationCache->GetNumParticles(in_frameIndex) <= buffer.m_particles.size(), "Simulation cache frame contains too many particles.");
+
+        buffer.m_numParticles = in_simulationCache->GetNumParticles(in_frameIndex);
+        in_simulationCache->DecodeFrame(in_frameIndex, buffer.m_particles.data());
+
+        buffer.m_aabb = in_simulationCache->GetAABB(in_frameIndex);
+        buffer.m_boundingSphere = in_simulationCache->GetBoundingSphere(in_frameIndex);
+        buffer.m_vertexData.m_isBuilt = false;
+
+        PublishBackBuffer();
+    }
+    //-----------------------------------------------------------------
+    //-----------------------------------------------------------------
+    void ConcurrentParticleData::PublishBackBuffer()
+    {
+        m_vertexDataWritten = false;
+
+        u32 previousState = m_publishedState.exchange(m_writeIndex | k_newDataFlag, std::memory_order_acq_rel);
+        m_writeIndex = previousState & k_bufferIndexMask;
+
+        m_updating.store(false, std::memory_order_release);
     }
-}
\ No newline at end of file
+}
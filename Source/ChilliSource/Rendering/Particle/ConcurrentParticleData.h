@@ -35,8 +35,10 @@
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
 
-#include <mutex>
+#include <atomic>
 #include <vector>
 
 namespace ChilliSource
@@ -44,8 +46,15 @@ namespace ChilliSource
     //------------------------------------------------------------------------
     /// A container for particle effect data that needs to be shared across
     /// the main thread and the particle update thread. This includes the
-    /// draw information for each particle, the list of newly updated particles
-    /// and the total bounds of the particle effect.
+    /// draw information for each particle and the total bounds of the
+    /// particle effect.
+    ///
+    /// The data is triple buffered: the update thread writes into a back
+    /// buffer which is published with a single atomic exchange, and the
+    /// main thread fetches the most recently published buffer in the same
+    /// way. Neither thread ever waits on the other. Only one update may
+    /// write at a time, which is enforced through StartUpdate(), and all
+    /// reading must occur on the main thread.
     ///
     /// @author Ian Copland
     //------------------------------------------------------------------------
@@ -54,26 +63,66 @@ namespace ChilliSource
     public:
         //-----------------------------------------------------------------
         /// A struct containing just the information required for drawing a
-        /// particle.
+        /// particle. The slot index remains constant for the lifetime of
+        /// the particle, so can be used to key any per-particle drawable
+        /// data. The slot generation changes each time the slot is reused,
+        /// so can be used to detect newly activated particles. The
+        /// previous position is the position prior to the final step of a
+        /// fixed time step update, which the position can be interpolated
+        /// from when drawn; otherwise it is the same as the position or
+        /// should be ignored.
         ///
         /// @author Ian Copland
         //-----------------------------------------------------------------
         struct Particle final
         {
-            bool m_isActive = false;
+            u32 m_slotIndex = 0;
+            u32 m_slotGeneration = 0;
             Vector3 m_position;
+            Vector3 m_previousPosition;
             Vector2 m_scale = Vector2::k_zero;
             f32 m_rotation = 0.0f;
             Colour m_colour = Colour::k_white;
         };
         //-----------------------------------------------------------------
+        /// Camera independent vertex data for the particles, which can
+        /// optionally be built by a particle vertex builder as part of the
+        /// background update. This contains four vertices for each quad,
+        /// with the UVs and colours set, and the billboard expansion
+        /// batches required to calculate the vertex positions once the
+        /// camera is known. The quads are split across the batches in
+        /// order, so each batch is full other than the last.
+        ///
+        /// @author agent
+        //-----------------------------------------------------------------
+        struct VertexData final
+        {
+            VertexData();
+
+            bool m_isBuilt = false;
+            u32 m_numQuads = 0;
+            dynamic_array<SpriteBatch::SpriteVertex> m_vertices;
+            dynamic_array<ParticleBillboardExpansion::Batch> m_batches;
+        };
+        //-----------------------------------------------------------------
         /// Constructor
         ///
         /// @author Ian Copland
         ///
         /// @param The number of particles.
+        /// @param The memory manager which all buffers are allocated from.
+        /// This must outlive the concurrent particle data.
+        //-----------------------------------------------------------------
+        ConcurrentParticleData(u32 in_particleCount, ParticleMemoryManager* in_memoryManager);
+        //-----------------------------------------------------------------
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @return The memory manager which all buffers are allocated
+        /// from.
         //-----------------------------------------------------------------
-        ConcurrentParticleData(u32 in_particleCount);
+        ParticleMemoryManager* GetMemoryManager() const;
         //-----------------------------------------------------------------
         /// This will return false if no particle data has been commited
         /// since the last time this was called. If false is returned a 
@@ -87,15 +136,29 @@ namespace ChilliSource
         //-----------------------------------------------------------------
         bool StartUpdate();
         //-----------------------------------------------------------------
-        /// This is thread-safe, lock doesn't need to be called first.
+        /// Fetches the most recently committed particle data, if any has
+        /// been committed since this was last called. The data returned
+        /// by the other getters will not change until this is called
+        /// again. This never blocks.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @author agent
+        ///
+        /// @return Whether or not new data was fetched.
+        //-----------------------------------------------------------------
+        bool FetchCommittedData();
+        //-----------------------------------------------------------------
+        /// This must be called on the main thread.
         ///
         /// @author Ian Copland
         ///
-        /// @param Whether or not there are any active particles.
+        /// @param Whether or not there are any active particles in the
+        /// fetched data.
         //-----------------------------------------------------------------
         bool HasActiveParticles() const;
         //-----------------------------------------------------------------
-        /// This is thread-safe, lock doesn't need to be called first.
+        /// This must be called on the main thread.
         ///
         /// @author Ian Copland
         ///
@@ -105,7 +168,7 @@ namespace ChilliSource
         //-----------------------------------------------------------------
         AABB GetAABB() const;
         //-----------------------------------------------------------------
-        /// This is thread-safe, lock doesn't need to be called first.
+        /// This must be called on the main thread.
         ///
         /// @author Ian Copland
         ///
@@ -115,68 +178,110 @@ namespace ChilliSource
         //-----------------------------------------------------------------
         Sphere GetBoundingSphere() const;
         //-----------------------------------------------------------------
-        /// Locks the container so other threads cannot update it while
-        /// accessing the new indices and particle list.
+        /// This must be called on the main thread.
         ///
-        /// @author Ian Copland
+        /// @author agent
+        ///
+        /// @return The number of active particles in the fetched data. The
+        /// active particles are always the first entries in the particle
+        /// list.
         //-----------------------------------------------------------------
-        void Lock() const;
+        u32 GetNumParticles() const;
         //-----------------------------------------------------------------
-        /// Returns the list of indices that have changed since the last
-        /// time this was called. The list will be cleared when called.
-        /// Before this is called the container must be locked to ensure
-        /// that new particles are not activated prior to being rendered.
-        /// If the container is not locked the app is considered to be
-        /// in an irrecoverable state and will terminate.
-        /// 
+        /// This must be called on the main thread.
+        ///
         /// @author Ian Copland
         ///
-        /// @author A vector of particle indices.
+        /// @param The fetched particle list.
         //-----------------------------------------------------------------
-        std::vector<u32> TakeNewIndices();
+        const dynamic_array<ConcurrentParticleData::Particle>& GetParticles() const;
         //-----------------------------------------------------------------
-        /// Before this is called the container must be locked to ensure
-        /// that any iteration over the particle data is safe. If not the
-        /// app is considered to be in an irrecoverable state and will
-        /// terminate.
+        /// This must be called on the main thread.
         ///
-        /// @author Ian Copland
+        /// @author agent
         ///
-        /// @param The particle list.
+        /// @return The fetched vertex data. This will only have been built
+        /// if a vertex builder wrote to it during the update which
+        /// committed the fetched data.
         //-----------------------------------------------------------------
-        const dynamic_array<ConcurrentParticleData::Particle>& GetParticles() const;
+        const VertexData& GetVertexData() const;
         //-----------------------------------------------------------------
-        /// Unlocks the container. This should be called as soon as possible
-        /// after dealing with data that needs to be locked.
+        /// Provides access to the vertex data in the back buffer so it can
+        /// be built by a particle vertex builder. The vertex data will be
+        /// marked as built when the particle data is next committed. This
+        /// can only be called after a successful call to StartUpdate().
         ///
-        /// @author Ian Copland
+        /// The vertex data storage is allocated from the memory manager the
+        /// first time each buffer is written to, so effects which never use
+        /// a vertex builder do not pay for it.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @return The vertex data in the back buffer.
         //-----------------------------------------------------------------
-        void Unlock() const;
+        VertexData* GetUncommittedVertexData();
         //-----------------------------------------------------------------
-        /// Updates the particle data.
+        /// Writes the particle data into the back buffer and publishes it
+        /// for the main thread to fetch. This can only be called after a
+        /// successful call to StartUpdate() and will allow the next update
+        /// to start.
         ///
-        /// This is thread-safe, lock doesn't need to be called first.
+        /// This is thread-safe.
         ///
         /// @author Ian Copland
         ///
         /// @param The list of particles.
-        /// @param The new indices.
         /// @param The aabb.
-        /// @param The obb.
         /// @param The bounding sphere.
         //-----------------------------------------------------------------
-        void CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere);
+        void CommitParticleData(const ParticleArray* in_particles, const AABB& in_aabb, const Sphere& in_boundingSphere);
+        //-----------------------------------------------------------------
+        /// Writes a frame of a baked particle simulation into the back
+        /// buffer and publishes it for the main thread to fetch. This can
+        /// only be called after a successful call to StartUpdate() and
+        /// will allow the next update to start.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The simulation cache.
+        /// @param The index of the frame to commit.
+        //-----------------------------------------------------------------
+        void CommitCachedParticleData(const ParticleSimulationCache* in_simulationCache, u32 in_frameIndex);
     private:
+        //-----------------------------------------------------------------
+        /// A single copy of the shared particle data.
+        ///
+        /// @author agent
+        //-----------------------------------------------------------------
+        struct Buffer final
+        {
+            Buffer(u32 in_particleCount, ParticleMemoryManager* in_memoryManager);
+
+            dynamic_array<ConcurrentParticleData::Particle> m_particles;
+            u32 m_numParticles = 0;
+            AABB m_aabb;
+            Sphere m_boundingSphere;
+            VertexData m_vertexData;
+        };
+        //-----------------------------------------------------------------
+        /// Publishes the back buffer for the main thread to fetch and
+        /// finishes the update.
+        ///
+        /// @author agent
+        //-----------------------------------------------------------------
+        void PublishBackBuffer();
 
-        dynamic_array<ConcurrentParticleData::Particle> m_particles;
-        std::vector<u32> m_newParticleIndices;
-        AABB m_aabb;
-        Sphere m_boundingSphere;
-        bool m_updating = false;
-        bool m_activeParticles = false;
-        
-        mutable std::recursive_mutex m_mutex;
-        mutable std::unique_lock<std::recursive_mutex> m_lock;
+        ParticleMemoryManager* m_memoryManager = nullptr;
+        std::vector<Buffer> m_buffers;
+        u32 m_writeIndex = 0;
+        u32 m_readIndex = 0;
+        bool m_vertexDataWritten = false;
+        std::atomic<u32> m_publishedState;
+        std::atomic<bool> m_updating;
     };
 }
 
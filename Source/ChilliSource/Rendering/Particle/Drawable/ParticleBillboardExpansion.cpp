@@ -0,0 +1,333 @@
+//
+//  ParticleBillboardExpansion.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
+
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CS_PARTICLEBILLBOARDEXPANSION_SSE2
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   define CS_PARTICLEBILLBOARDEXPANSION_NEON
+#   include <arm_neon.h>
+#endif
+
+#include <cmath>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace ParticleBillboardExpansion
+    {
+        namespace
+        {
+            static_assert(sizeof(Vector4) == 4 * sizeof(f32), "Vectorised billboard expansion requires Vector4 to be tightly packed.");
+
+            const u32 k_laneCount = 4;
+
+            //----------------------------------------------------------------
+            /// Expands the billboards in the given range one at a time.
+            ///
+            /// @author agent
+            ///
+            /// @param The batch of billboards.
+            /// @param The index of the first billboard to expand.
+            /// @param The world space right vector of the camera.
+            /// @param The world space up vector of the camera.
+            /// @param [Out] The vertices of the quads.
+            //----------------------------------------------------------------
+            void ExpandRangeScalar(const Batch& in_batch, u32 in_start, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                for (u32 i = in_start; i < in_batch.m_size; ++i)
+                {
+                    const f32 c = in_batch.m_cos[i];
+                    const f32 s = in_batch.m_sin[i];
+
+                    //the billboard's local x and y axes, rotated in the view plane.
+                    const Vector3 axisX(c * in_cameraRight.x + s * in_cameraUp.x, c * in_cameraRight.y + s * in_cameraUp.y, c * in_cameraRight.z + s * in_cameraUp.z);
+                    const Vector3 axisY(c * in_cameraUp.x - s * in_cameraRight.x, c * in_cameraUp.y - s * in_cameraRight.y, c * in_cameraUp.z - s * in_cameraRight.z);
+                    const Vector3 position(in_batch.m_positionX[i], in_batch.m_positionY[i], in_batch.m_positionZ[i]);
+
+                    const Vector3 left = position + axisX * in_batch.m_left[i];
+                    const Vector3 right = position + axisX * in_batch.m_right[i];
+                    const Vector3 bottom = axisY * in_batch.m_bottom[i];
+                    const Vector3 top = axisY * in_batch.m_top[i];
+
+                    SpriteBatch::SpriteVertex* vertices = out_vertices + i * k_numSpriteVerts;
+                    vertices[(u32)SpriteBatch::Verts::k_topLeft].vPos = Vector4(left + top, 1.0f);
+                    vertices[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Vector4(left + bottom, 1.0f);
+                    vertices[(u32)SpriteBatch::Verts::k_topRight].vPos = Vector4(right + top, 1.0f);
+                    vertices[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Vector4(right + bottom, 1.0f);
+                }
+            }
+
+#if defined(CS_PARTICLEBILLBOARDEXPANSION_SSE2)
+            //----------------------------------------------------------------
+            /// Writes the given corner of four consecutive quads.
+            ///
+            /// @author agent
+            ///
+            /// @param The x components of the corner for each lane.
+            /// @param The y components of the corner for each lane.
+            /// @param The z components of the corner for each lane.
+            /// @param The corner.
+            /// @param [Out] The vertices of the first of the four quads.
+            //----------------------------------------------------------------
+            inline void StoreCorner(__m128 in_x, __m128 in_y, __m128 in_z, SpriteBatch::Verts in_corner, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                __m128 w = _mm_set1_ps(1.0f);
+                _MM_TRANSPOSE4_PS(in_x, in_y, in_z, w);
+
+                _mm_storeu_ps(&out_vertices[0 * k_numSpriteVerts + (u32)in_corner].vPos.x, in_x);
+                _mm_storeu_ps(&out_vertices[1 * k_numSpriteVerts + (u32)in_corner].vPos.x, in_y);
+                _mm_storeu_ps(&out_vertices[2 * k_numSpriteVerts + (u32)in_corner].vPos.x, in_z);
+                _mm_storeu_ps(&out_vertices[3 * k_numSpriteVerts + (u32)in_corner].vPos.x, w);
+            }
+            //----------------------------------------------------------------
+            /// Expands as many billboards as possible four at a time using
+            /// SSE2.
+            ///
+            /// @author agent
+            ///
+            /// @param The batch of billboards.
+            /// @param The world space right vector of the camera.
+            /// @param The world space up vector of the camera.
+            /// @param [Out] The vertices of the quads.
+            ///
+            /// @return The index after the last billboard that was
+            /// expanded. This will always be a multiple of four.
+            //----------------------------------------------------------------
+            u32 ExpandBatched(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                const u32 batchedEnd = in_batch.m_size - (in_batch.m_size % k_laneCount);
+
+                const __m128 rightX = _mm_set1_ps(in_cameraRight.x);
+                const __m128 rightY = _mm_set1_ps(in_cameraRight.y);
+                const __m128 rightZ = _mm_set1_ps(in_cameraRight.z);
+                const __m128 upX = _mm_set1_ps(in_cameraUp.x);
+                const __m128 upY = _mm_set1_ps(in_cameraUp.y);
+                const __m128 upZ = _mm_set1_ps(in_cameraUp.z);
+
+                for (u32 i = 0; i < batchedEnd; i += k_laneCount)
+                {
+                    const __m128 c = _mm_loadu_ps(in_batch.m_cos + i);
+                    const __m128 s = _mm_loadu_ps(in_batch.m_sin + i);
+
+                    const __m128 axisXX = _mm_add_ps(_mm_mul_ps(c, rightX), _mm_mul_ps(s, upX));
+                    const __m128 axisXY = _mm_add_ps(_mm_mul_ps(c, rightY), _mm_mul_ps(s, upY));
+                    const __m128 axisXZ = _mm_add_ps(_mm_mul_ps(c, rightZ), _mm_mul_ps(s, upZ));
+                    const __m128 axisYX = _mm_sub_ps(_mm_mul_ps(c, upX), _mm_mul_ps(s, rightX));
+                    const __m128 axisYY = _mm_sub_ps(_mm_mul_ps(c, upY), _mm_mul_ps(s, rightY));
+                    const __m128 axisYZ = _mm_sub_ps(_mm_mul_ps(c, upZ), _mm_mul_ps(s, rightZ));
+
+                    const __m128 positionX = _mm_loadu_ps(in_batch.m_positionX + i);
+                    const __m128 positionY = _mm_loadu_ps(in_batch.m_positionY + i);
+                    const __m128 positionZ = _mm_loadu_ps(in_batch.m_positionZ + i);
+                    const __m128 l = _mm_loadu_ps(in_batch.m_left + i);
+                    const __m128 r = _mm_loadu_ps(in_batch.m_right + i);
+                    const __m128 b = _mm_loadu_ps(in_batch.m_bottom + i);
+                    const __m128 t = _mm_loadu_ps(in_batch.m_top + i);
+
+                    const __m128 leftX = _mm_add_ps(positionX, _mm_mul_ps(axisXX, l));
+                    const __m128 leftY = _mm_add_ps(positionY, _mm_mul_ps(axisXY, l));
+                    const __m128 leftZ = _mm_add_ps(positionZ, _mm_mul_ps(axisXZ, l));
+                    const __m128 rightCornerX = _mm_add_ps(positionX, _mm_mul_ps(axisXX, r));
+                    const __m128 rightCornerY = _mm_add_ps(positionY, _mm_mul_ps(axisXY, r));
+                    const __m128 rightCornerZ = _mm_add_ps(positionZ, _mm_mul_ps(axisXZ, r));
+                    const __m128 bottomX = _mm_mul_ps(axisYX, b);
+                    const __m128 bottomY = _mm_mul_ps(axisYY, b);
+                    const __m128 bottomZ = _mm_mul_ps(axisYZ, b);
+                    const __m128 topX = _mm_mul_ps(axisYX, t);
+                    const __m128 topY = _mm_mul_ps(axisYY, t);
+                    const __m128 topZ = _mm_mul_ps(axisYZ, t);
+
+                    SpriteBatch::SpriteVertex* vertices = out_vertices + i * k_numSpriteVerts;
+                    StoreCorner(_mm_add_ps(leftX, topX), _mm_add_ps(leftY, topY), _mm_add_ps(leftZ, topZ), SpriteBatch::Verts::k_topLeft, vertices);
+                    StoreCorner(_mm_add_ps(leftX, bottomX), _mm_add_ps(leftY, bottomY), _mm_add_ps(leftZ, bottomZ), SpriteBatch::Verts::k_bottomLeft, vertices);
+                    StoreCorner(_mm_add_ps(rightCornerX, topX), _mm_add_ps(rightCornerY, topY), _mm_add_ps(rightCornerZ, topZ), SpriteBatch::Verts::k_topRight, vertices);
+                    StoreCorner(_mm_add_ps(rightCornerX, bottomX), _mm_add_ps(rightCornerY, bottomY), _mm_add_ps(rightCornerZ, bottomZ), SpriteBatch::Verts::k_bottomRight, vertices);
+                }
+
+                return batchedEnd;
+            }
+#elif defined(CS_PARTICLEBILLBOARDEXPANSION_NEON)
+            //----------------------------------------------------------------
+            /// Writes the given corner of four consecutive quads.
+            ///
+            /// @author agent
+            ///
+            /// @param The x components of the corner for each lane.
+            /// @param The y components of the corner for each lane.
+            /// @param The z components of the corner for each lane.
+            /// @param The corner.
+            /// @param [Out] The vertices of the first of the four quads.
+            //----------------------------------------------------------------
+            inline void StoreCorner(float32x4_t in_x, float32x4_t in_y, float32x4_t in_z, SpriteBatch::Verts in_corner, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                float32x4x4_t components;
+                components.val[0] = in_x;
+                components.val[1] = in_y;
+                components.val[2] = in_z;
+                components.val[3] = vdupq_n_f32(1.0f);
+
+                f32 interleaved[k_laneCount * 4];
+                vst4q_f32(interleaved, components);
+
+                for (u32 lane = 0; lane < k_laneCount; ++lane)
+                {
+                    std::memcpy(&out_vertices[lane * k_numSpriteVerts + (u32)in_corner].vPos, interleaved + lane * 4, sizeof(Vector4));
+                }
+            }
+            //----------------------------------------------------------------
+            /// Expands as many billboards as possible four at a time using
+            /// NEON.
+            ///
+            /// @author agent
+            ///
+            /// @param The batch of billboards.
+            /// @param The world space right vector of the camera.
+            /// @param The world space up vector of the camera.
+            /// @param [Out] The vertices of the quads.
+            ///
+            /// @return The index after the last billboard that was
+            /// expanded. This will always be a multiple of four.
+            //----------------------------------------------------------------
+            u32 ExpandBatched(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                const u32 batchedEnd = in_batch.m_size - (in_batch.m_size % k_laneCount);
+
+                const float32x4_t rightX = vdupq_n_f32(in_cameraRight.x);
+                const float32x4_t rightY = vdupq_n_f32(in_cameraRight.y);
+                const float32x4_t rightZ = vdupq_n_f32(in_cameraRight.z);
+                const float32x4_t upX = vdupq_n_f32(in_cameraUp.x);
+                const float32x4_t upY = vdupq_n_f32(in_cameraUp.y);
+                const float32x4_t upZ = vdupq_n_f32(in_cameraUp.z);
+
+                for (u32 i = 0; i < batchedEnd; i += k_laneCount)
+                {
+                    const float32x4_t c = vld1q_f32(in_batch.m_cos + i);
+                    const float32x4_t s = vld1q_f32(in_batch.m_sin + i);
+
+                    //multiply and add separately, rather than fused, to match the scalar path.
+                    const float32x4_t axisXX = vaddq_f32(vmulq_f32(c, rightX), vmulq_f32(s, upX));
+                    const float32x4_t axisXY = vaddq_f32(vmulq_f32(c, rightY), vmulq_f32(s, upY));
+                    const float32x4_t axisXZ = vaddq_f32(vmulq_f32(c, rightZ), vmulq_f32(s, upZ));
+                    const float32x4_t axisYX = vsubq_f32(vmulq_f32(c, upX), vmulq_f32(s, rightX));
+                    const float32x4_t axisYY = vsubq_f32(vmulq_f32(c, upY), vmulq_f32(s, rightY));
+                    const float32x4_t axisYZ = vsubq_f32(vmulq_f32(c, upZ), vmulq_f32(s, rightZ));
+
+                    const float32x4_t positionX = vld1q_f32(in_batch.m_positionX + i);
+                    const float32x4_t positionY = vld1q_f32(in_batch.m_positionY + i);
+                    const float32x4_t positionZ = vld1q_f32(in_batch.m_positionZ + i);
+                    const float32x4_t l = vld1q_f32(in_batch.m_left + i);
+                    const float32x4_t r = vld1q_f32(in_batch.m_right + i);
+                    const float32x4_t b = vld1q_f32(in_batch.m_bottom + i);
+                    const float32x4_t t = vld1q_f32(in_batch.m_top + i);
+
+                    const float32x4_t leftX = vaddq_f32(positionX, vmulq_f32(axisXX, l));
+                    const float32x4_t leftY = vaddq_f32(positionY, vmulq_f32(axisXY, l));
+                    const float32x4_t leftZ = vaddq_f32(positionZ, vmulq_f32(axisXZ, l));
+                    const float32x4_t rightCornerX = vaddq_f32(positionX, vmulq_f32(axisXX, r));
+                    const float32x4_t rightCornerY = vaddq_f32(positionY, vmulq_f32(axisXY, r));
+                    const float32x4_t rightCornerZ = vaddq_f32(positionZ, vmulq_f32(axisXZ, r));
+                    const float32x4_t bottomX = vmulq_f32(axisYX, b);
+                    const float32x4_t bottomY = vmulq_f32(axisYY, b);
+                    const float32x4_t bottomZ = vmulq_f32(axisYZ, b);
+                    const float32x4_t topX = vmulq_f32(axisYX, t);
+                    const float32x4_t topY = vmulq_f32(axisYY, t);
+                    const float32x4_t topZ = vmulq_f32(axisYZ, t);
+
+                    SpriteBatch::SpriteVertex* vertices = out_vertices + i * k_numSpriteVerts;
+                    StoreCorner(vaddq_f32(leftX, topX), vaddq_f32(leftY, topY), vaddq_f32(leftZ, topZ), SpriteBatch::Verts::k_topLeft, vertices);
+                    StoreCorner(vaddq_f32(leftX, bottomX), vaddq_f32(leftY, bottomY), vaddq_f32(leftZ, bottomZ), SpriteBatch::Verts::k_bottomLeft, vertices);
+                    StoreCorner(vaddq_f32(rightCornerX, topX), vaddq_f32(rightCornerY, topY), vaddq_f32(rightCornerZ, topZ), SpriteBatch::Verts::k_topRight, vertices);
+                    StoreCorner(vaddq_f32(rightCornerX, bottomX), vaddq_f32(rightCornerY, bottomY), vaddq_f32(rightCornerZ, bottomZ), SpriteBatch::Verts::k_bottomRight, vertices);
+                }
+
+                return batchedEnd;
+            }
+#else
+            //----------------------------------------------------------------
+            /// Vectorised expansion is not supported on this architecture
+            /// so no billboards are expanded in batches.
+            ///
+            /// @author agent
+            ///
+            /// @param The batch of billboards.
+            /// @param The world space right vector of the camera.
+            /// @param The world space up vector of the camera.
+            /// @param [Out] The vertices of the quads.
+            ///
+            /// @return The index after the last billboard that was
+            /// expanded.
+            //----------------------------------------------------------------
+            u32 ExpandBatched(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+            {
+                return 0;
+            }
+#endif
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Batch::Add(const Vector3& in_position, const Vector2& in_bottomLeft, const Vector2& in_topRight, f32 in_rotation)
+        {
+            CS_ASSERT(m_size < k_maxBatchSize, "Cannot add to a full billboard batch.");
+
+            m_positionX[m_size] = in_position.x;
+            m_positionY[m_size] = in_position.y;
+            m_positionZ[m_size] = in_position.z;
+            m_left[m_size] = in_bottomLeft.x;
+            m_right[m_size] = in_topRight.x;
+            m_bottom[m_size] = in_bottomLeft.y;
+            m_top[m_size] = in_topRight.y;
+            m_cos[m_size] = std::cos(in_rotation);
+            m_sin[m_size] = std::sin(in_rotation);
+            ++m_size;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Expand(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+        {
+            CS_ASSERT(out_vertices != nullptr, "Cannot expand billboards into null vertices.");
+
+            const u32 batchedEnd = ExpandBatched(in_batch, in_cameraRight, in_cameraUp, out_vertices);
+            ExpandRangeScalar(in_batch, batchedEnd, in_cameraRight, in_cameraUp, out_vertices);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void ExpandScalar(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
+        {
+            CS_ASSERT(out_vertices != nullptr, "Cannot expand billboards into null vertices.");
+
+            ExpandRangeScalar(in_batch, 0, in_cameraRight, in_cameraUp, out_vertices);
+        }
+    }
+}
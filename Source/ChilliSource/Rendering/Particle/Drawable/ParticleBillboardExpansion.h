@@ -0,0 +1,125 @@
+//
+//  ParticleBillboardExpansion.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEBILLBOARDEXPANSION_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEBILLBOARDEXPANSION_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A collection of methods for expanding particle billboards into the
+    /// four world space corner positions of a quad.
+    ///
+    /// Rather than building an orientation quaternion for each particle and
+    /// rotating each corner by it, the camera right and up vectors are
+    /// calculated once per draw and the sine and cosine of the particle
+    /// rotation once per particle. Each corner is then a few multiply-adds.
+    ///
+    /// Where supported by the target architecture the billboards are
+    /// processed four at a time using SSE2 or NEON, otherwise a scalar path
+    /// is used. All paths produce the same results.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    namespace ParticleBillboardExpansion
+    {
+        //----------------------------------------------------------------
+        /// The maximum number of billboards in a single batch.
+        //----------------------------------------------------------------
+        constexpr u32 k_maxBatchSize = 64;
+        //----------------------------------------------------------------
+        /// A batch of billboards, stored as a structure of arrays so it
+        /// can be processed in a vectorised manner. The extents are in
+        /// local space and already scaled, so the corners of a billboard
+        /// before rotation are (left, bottom), (left, top), (right, top)
+        /// and (right, bottom).
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct Batch final
+        {
+            //----------------------------------------------------------------
+            /// Adds a billboard to the batch. The batch must not be full.
+            ///
+            /// @author agent
+            ///
+            /// @param The world space centre of the billboard.
+            /// @param The scaled local bottom left of the billboard.
+            /// @param The scaled local top right of the billboard.
+            /// @param The rotation of the billboard around the view
+            /// direction.
+            //----------------------------------------------------------------
+            void Add(const Vector3& in_position, const Vector2& in_bottomLeft, const Vector2& in_topRight, f32 in_rotation);
+
+            u32 m_size = 0;
+            alignas(16) f32 m_positionX[k_maxBatchSize];
+            alignas(16) f32 m_positionY[k_maxBatchSize];
+            alignas(16) f32 m_positionZ[k_maxBatchSize];
+            alignas(16) f32 m_left[k_maxBatchSize];
+            alignas(16) f32 m_right[k_maxBatchSize];
+            alignas(16) f32 m_bottom[k_maxBatchSize];
+            alignas(16) f32 m_top[k_maxBatchSize];
+            alignas(16) f32 m_cos[k_maxBatchSize];
+            alignas(16) f32 m_sin[k_maxBatchSize];
+        };
+        //----------------------------------------------------------------
+        /// Calculates the world space positions of the corners of each
+        /// billboard in the batch, writing them to the vertices of
+        /// consecutive quads in the order described by SpriteBatch::Verts.
+        /// Only the positions of the vertices are written.
+        ///
+        /// @author agent
+        ///
+        /// @param The batch of billboards.
+        /// @param The world space right vector of the camera.
+        /// @param The world space up vector of the camera.
+        /// @param [Out] The vertices of the quads. There must be four for
+        /// each billboard in the batch.
+        //----------------------------------------------------------------
+        void Expand(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices);
+        //----------------------------------------------------------------
+        /// Calculates the corner positions in the same way as Expand(),
+        /// one billboard at a time. This will give the same results as
+        /// Expand(), but will never use the vectorised path.
+        ///
+        /// @author agent
+        ///
+        /// @param The batch of billboards.
+        /// @param The world space right vector of the camera.
+        /// @param The world space up vector of the camera.
+        /// @param [Out] The vertices of the quads. There must be four for
+        /// each billboard in the batch.
+        //----------------------------------------------------------------
+        void ExpandScalar(const Batch& in_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices);
+    }
+}
+
+#endif
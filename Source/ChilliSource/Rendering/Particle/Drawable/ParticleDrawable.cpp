@@ -29,30 +29,53 @@
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDef.h>
 
 namespace ChilliSource
 {
     //----------------------------------------------
     //----------------------------------------------
     ParticleDrawable::ParticleDrawable(const Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData)
-        : m_entity(in_entity), m_drawableDef(in_drawableDef), m_concurrentParticleData(in_concurrentParticleData)
+        : m_entity(in_entity), m_drawableDef(in_drawableDef), m_concurrentParticleData(in_concurrentParticleData), m_slotGenerations(in_concurrentParticleData->GetMemoryManager()->AllocateArray<u32>(in_drawableDef->GetParticleEffect()->GetMaxParticles()))
     {
+        m_slotGenerations.fill(0);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void ParticleDrawable::Draw(const CameraComponent* in_camera)
+    void ParticleDrawable::Draw(const CameraComponent* in_camera, f32 in_interpolationFactor)
     {
-        m_concurrentParticleData->Lock();
+        m_concurrentParticleData->FetchCommittedData();
 
-        auto newIndices = m_concurrentParticleData->TakeNewIndices();
-        for (const auto& index : newIndices)
+        const auto& vertexData = m_concurrentParticleData->GetVertexData();
+        if (vertexData.m_isBuilt == true)
         {
-            ActivateParticle(m_concurrentParticleData->GetParticles(), index);
+            DrawVertexData(vertexData, in_camera);
+            return;
         }
 
-        DrawParticles(m_concurrentParticleData->GetParticles(), in_camera);
+        const auto& particles = m_concurrentParticleData->GetParticles();
+        u32 numParticles = m_concurrentParticleData->GetNumParticles();
 
-        m_concurrentParticleData->Unlock();
+        //a changed generation means the slot has been reused since it was last seen, even if intermediate commits were never fetched.
+        for (u32 i = 0; i < numParticles; ++i)
+        {
+            const auto& particle = particles[i];
+            if (m_slotGenerations[particle.m_slotIndex] != particle.m_slotGeneration)
+            {
+                m_slotGenerations[particle.m_slotIndex] = particle.m_slotGeneration;
+                ActivateParticle(particles, particle.m_slotIndex);
+            }
+        }
+
+        DrawParticles(particles, numParticles, in_camera, in_interpolationFactor);
+    }
+    //----------------------------------------------
+    //----------------------------------------------
+    ParticleVertexBuilderSPtr ParticleDrawable::GetVertexBuilder() const
+    {
+        return nullptr;
     }
     //----------------------------------------------
     //----------------------------------------------
@@ -66,4 +89,10 @@ namespace ChilliSource
     {
         return m_drawableDef;
     }
+    //----------------------------------------------
+    //----------------------------------------------
+    void ParticleDrawable::DrawVertexData(const ConcurrentParticleData::VertexData& in_vertexData, const CameraComponent* in_camera)
+    {
+        CS_LOG_FATAL("This particle drawable does not support prebuilt vertex data.");
+    }
 }
\ No newline at end of file
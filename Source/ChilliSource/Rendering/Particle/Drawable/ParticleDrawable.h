@@ -41,8 +41,8 @@ namespace ChilliSource
     /// Particle drawables are drawn from the main thread, however particles 
     /// are updated from a background task. Information is passed between 
     /// threads using the concurrent particle draw data array. This contains 
-    /// just the information needed to render a particle and can be locked 
-    /// before use.
+    /// just the information needed to render a particle and is buffered so
+    /// that drawing never blocks the update.
     ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
@@ -69,8 +69,23 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The camera component used to render.
+        /// @param The factor by which particle positions are interpolated
+        /// from their previous positions, in the range [0, 1]. This should
+        /// be one unless the effect is simulated in fixed time steps.
+        /// Vertex data built during the background update is always drawn
+        /// at the current positions.
         //----------------------------------------------------------------
-        void Draw(const CameraComponent* in_camera);
+        void Draw(const CameraComponent* in_camera, f32 in_interpolationFactor);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The vertex builder which should be used to build the
+        /// camera independent vertex data for the particles as part of
+        /// the background update. If null, all vertex data is built when
+        /// the particles are drawn. By default no vertex builder is
+        /// provided.
+        //----------------------------------------------------------------
+        virtual ParticleVertexBuilderSPtr GetVertexBuilder() const;
         //----------------------------------------------------------------
         /// Destructor
         ///
@@ -92,16 +107,17 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const ParticleDrawableDef* GetDrawableDef() const;
         //----------------------------------------------------------------
-        /// Activates the particle with the given index.
+        /// Activates the particle with the given slot index. The slot
+        /// index remains constant while the particle is active, so should
+        /// be used to key any per-particle data.
         ///
-        /// This is called on the main thread, but the particle data can 
-        /// be modified on other threads so make sure to lock it prior to 
-        /// use.
+        /// This is always called on the main thread, immediately before
+        /// the first draw which includes the particle.
         ///
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
-        /// @param The index of the particle to activate.
+        /// @param The slot index of the particle to activate.
         //----------------------------------------------------------------
         virtual void ActivateParticle(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) = 0;
         //----------------------------------------------------------------
@@ -112,13 +128,33 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
+        /// @param The number of active particles. These are always the
+        /// first entries in the particle draw data.
+        /// @param The camera component used to render.
+        /// @param The factor by which particle positions should be
+        /// interpolated from their previous positions. If one, the
+        /// previous positions should be ignored.
+        //----------------------------------------------------------------
+        virtual void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera, f32 in_interpolationFactor) = 0;
+        //----------------------------------------------------------------
+        /// Renders the particles from vertex data which was built by the
+        /// vertex builder during the background update. This is only
+        /// called if the drawable provides a vertex builder, in which case
+        /// it must be overridden.
+        ///
+        /// This is always called on the main thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The prebuilt vertex data.
         /// @param The camera component used to render.
         //----------------------------------------------------------------
-        virtual void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) = 0;
+        virtual void DrawVertexData(const ConcurrentParticleData::VertexData& in_vertexData, const CameraComponent* in_camera);
     private:
         const Entity* m_entity = nullptr;
         const ParticleDrawableDef* m_drawableDef = nullptr;
         ConcurrentParticleData* m_concurrentParticleData = nullptr;
+        dynamic_array<u32> m_slotGenerations;
     };
 }
 
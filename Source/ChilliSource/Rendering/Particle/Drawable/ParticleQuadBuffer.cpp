@@ -0,0 +1,149 @@
+//
+//  ParticleQuadBuffer.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleQuadBuffer.h>
+
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Rendering/Base/RenderSystem.h>
+#include <ChilliSource/Rendering/Base/ShaderPass.h>
+#include <ChilliSource/Rendering/Base/VertexLayouts.h>
+#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        //The maximum number of quads which can be addressed by 16-bit indices.
+        constexpr u32 k_maxQuadsPerMeshBuffer = 65536 / k_numSpriteVerts;
+
+        //CCW winding order (back face cull), matching the sprite batch.
+        const u16 k_localIndices[] = {0, 1, 2, 1, 3, 2};
+    }
+
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleQuadBuffer::ParticleQuadBuffer(RenderSystem* in_renderSystem, u32 in_maxQuads)
+        : m_renderSystem(in_renderSystem), m_vertices(in_maxQuads * k_numSpriteVerts)
+    {
+        CS_ASSERT(m_renderSystem != nullptr, "Cannot create a particle quad buffer without a render system.");
+
+        u32 remainingQuads = in_maxQuads;
+        while (remainingQuads > 0)
+        {
+            const u32 numQuads = std::min(remainingQuads, k_maxQuadsPerMeshBuffer);
+            remainingQuads -= numQuads;
+
+            BufferDescription desc;
+            desc.eUsageFlag = BufferUsage::k_dynamic;
+            desc.VertexDataCapacity = numQuads * k_numSpriteVerts * sizeof(SpriteBatch::SpriteVertex);
+            desc.IndexDataCapacity = numQuads * k_numSpriteIndices * sizeof(u16);
+            desc.ePrimitiveType = PrimitiveType::k_tri;
+            desc.eAccessFlag = BufferAccess::k_read;
+            desc.VertexLayout = VertexLayout::kSprite;
+            desc.IndexSize = sizeof(u16);
+
+            MeshBuffer* meshBuffer = m_renderSystem->CreateBuffer(desc);
+            meshBuffer->Bind();
+            meshBuffer->SetIndexCount(numQuads * k_numSpriteIndices);
+
+            u16* indices = nullptr;
+            meshBuffer->LockIndex(&indices, 0, 0);
+            for (u32 quad = 0; quad < numQuads; ++quad)
+            {
+                for (u32 i = 0; i < k_numSpriteIndices; ++i)
+                {
+                    indices[quad * k_numSpriteIndices + i] = u16(k_localIndices[i] + quad * k_numSpriteVerts);
+                }
+            }
+            meshBuffer->UnlockIndex();
+
+            m_meshBuffers.push_back(meshBuffer);
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleQuadBuffer::GetMaxQuads() const
+    {
+        return u32(m_vertices.size()) / k_numSpriteVerts;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    SpriteBatch::SpriteVertex* ParticleQuadBuffer::GetVertices()
+    {
+        return m_vertices.data();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleQuadBuffer::Render(const MaterialCSPtr& in_material, u32 in_numQuads)
+    {
+        CS_ASSERT(in_numQuads <= GetMaxQuads(), "Cannot render more quads than the buffer can hold.");
+
+        if (in_numQuads == 0)
+        {
+            return;
+        }
+
+        //flush the sprite cache to maintain order.
+        m_renderSystem->GetDynamicSpriteBatchPtr()->ForceRender();
+
+        u32 firstQuad = 0;
+        for (MeshBuffer* meshBuffer : m_meshBuffers)
+        {
+            const u32 numQuads = std::min(in_numQuads - firstQuad, k_maxQuadsPerMeshBuffer);
+            if (numQuads == 0)
+            {
+                break;
+            }
+
+            meshBuffer->Bind();
+            meshBuffer->SetVertexCount(numQuads * k_numSpriteVerts);
+
+            f32* vertices = nullptr;
+            meshBuffer->LockVertex(&vertices, 0, 0);
+            std::memcpy(vertices, m_vertices.data() + firstQuad * k_numSpriteVerts, numQuads * k_numSpriteVerts * sizeof(SpriteBatch::SpriteVertex));
+            meshBuffer->UnlockVertex();
+
+            m_renderSystem->ApplyMaterial(in_material, ShaderPass::k_ambient);
+            m_renderSystem->RenderBuffer(meshBuffer, 0, numQuads * k_numSpriteIndices, Matrix4::k_identity);
+
+            firstQuad += numQuads;
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleQuadBuffer::~ParticleQuadBuffer()
+    {
+        for (MeshBuffer* meshBuffer : m_meshBuffers)
+        {
+            CS_SAFEDELETE(meshBuffer);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+//
+//  ParticleQuadBuffer.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEQUADBUFFER_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEQUADBUFFER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A persistent, pre-sized stream of quads used by particle drawables.
+    /// Drawables write the vertices of each quad directly into the stream,
+    /// which is then uploaded and rendered with a single draw call, rather
+    /// than going through the dynamic sprite batch one sprite at a time.
+    ///
+    /// Vertices use the sprite vertex layout, four per quad, in the order
+    /// described by SpriteBatch::Verts. The index data is built once on
+    /// construction. Quads are split across multiple mesh buffers only when
+    /// there are more than can be addressed with 16-bit indices.
+    ///
+    /// This is not thread-safe and should only be used on the render thread.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleQuadBuffer final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleQuadBuffer);
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param The render system used to create the mesh buffers.
+        /// @param The maximum number of quads that can be rendered.
+        //----------------------------------------------------------------
+        ParticleQuadBuffer(RenderSystem* in_renderSystem, u32 in_maxQuads);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The maximum number of quads that can be rendered.
+        //----------------------------------------------------------------
+        u32 GetMaxQuads() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The vertex stream. This contains four vertices for
+        /// each quad, enough for the maximum number of quads.
+        //----------------------------------------------------------------
+        SpriteBatch::SpriteVertex* GetVertices();
+        //----------------------------------------------------------------
+        /// Uploads the first given number of quads to the mesh buffers
+        /// and renders them with the given material. Any sprites
+        /// currently held in the dynamic sprite batch are flushed first
+        /// to maintain render order.
+        ///
+        /// @author agent
+        ///
+        /// @param The material to render with.
+        /// @param The number of quads to render.
+        //----------------------------------------------------------------
+        void Render(const MaterialCSPtr& in_material, u32 in_numQuads);
+        //----------------------------------------------------------------
+        /// Destructor.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ~ParticleQuadBuffer();
+    private:
+        RenderSystem* m_renderSystem = nullptr;
+        dynamic_array<SpriteBatch::SpriteVertex> m_vertices;
+        std::vector<MeshBuffer*> m_meshBuffers;
+    };
+}
+
+#endif
@@ -0,0 +1,104 @@
+//
+//  ParticleVertexBuilder.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEVERTEXBUILDER_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_DRAWABLE_PARTICLEVERTEXBUILDER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// The base class for particle vertex builders. A vertex builder can
+    /// optionally be provided by a particle drawable to build the camera
+    /// independent vertex data for the particles as part of the background
+    /// update, rather than on the render thread. The drawable is then only
+    /// left to complete the vertex data once the camera is known.
+    ///
+    /// Vertex builders are only ever used by the particle update, which
+    /// never runs concurrently with itself for a single effect, so they
+    /// can be stateful. They should not be accessed from the main thread
+    /// after construction.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleVertexBuilder
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleVertexBuilder);
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ParticleVertexBuilder() = default;
+        //----------------------------------------------------------------
+        /// Activates the newly emitted particle at the given index in the
+        /// particle array. The slot index of the particle should be used
+        /// to key any per-particle data.
+        ///
+        /// This is called from the particle update, which may be on a
+        /// background thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The index of the particle to activate.
+        //----------------------------------------------------------------
+        virtual void ActivateParticle(const ParticleArray* in_particleArray, u32 in_index) = 0;
+        //----------------------------------------------------------------
+        /// Builds the vertex data for all active particles in the given
+        /// particle array.
+        ///
+        /// This is called from the particle update, which may be on a
+        /// background thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The world position of the owning entity at the time
+        /// the update was queued.
+        /// @param The world scale of the owning entity at the time the
+        /// update was queued.
+        /// @param The world orientation of the owning entity at the time
+        /// the update was queued.
+        /// @param [Out] The vertex data.
+        //----------------------------------------------------------------
+        virtual void BuildVertexData(const ParticleArray* in_particleArray, const Vector3& in_entityPosition, const Vector3& in_entityScale, const Quaternion& in_entityOrientation,
+            ConcurrentParticleData::VertexData* out_vertexData) = 0;
+        //----------------------------------------------------------------
+        /// Destructor
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        virtual ~ParticleVertexBuilder() {};
+    };
+}
+
+#endif
@@ -29,9 +29,12 @@
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawable.h>
 
 #include <ChilliSource/Core/Container/dynamic_array.h>
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleBillboardExpansion.h>
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawableDef.h>
 
 #include <ChilliSource/Core/Base/Application.h>
@@ -44,10 +47,11 @@
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
 #include <ChilliSource/Rendering/Camera/CameraComponent.h>
 #include <ChilliSource/Rendering/Material/Material.h>
-#include <ChilliSource/Rendering/Sprite/DynamicSpriteBatcher.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace
@@ -86,73 +90,256 @@ namespace ChilliSource
             }
         }
         //-----------------------------------------------------------------------------
-        /// Builds world space sprite data for a particle from the given parameters.
+        /// Selects the billboard which should be used for a newly activated particle.
         ///
-        /// @author Ian Copland
+        /// @author agent
+        ///
+        /// @param The image selection type.
+        /// @param The number of billboards.
+        /// @param [In/Out] The next billboard index when cycling. This will be
+        /// updated if it is used.
+        /// @param [In/Out] The random number generator used for random selection.
+        ///
+        /// @return The index of the selected billboard.
+        //-----------------------------------------------------------------------------
+        u32 SelectBillboard(StaticBillboardParticleDrawableDef::ImageSelectionType in_imageSelectionType, u32 in_numBillboards, u32& inout_nextBillboardIndex, FastRandom& inout_random)
+        {
+            switch (in_imageSelectionType)
+            {
+            case StaticBillboardParticleDrawableDef::ImageSelectionType::k_cycle:
+            {
+                u32 billboardIndex = inout_nextBillboardIndex++;
+                if (inout_nextBillboardIndex >= in_numBillboards)
+                {
+                    inout_nextBillboardIndex = 0;
+                }
+                return billboardIndex;
+            }
+            case StaticBillboardParticleDrawableDef::ImageSelectionType::k_random:
+                return inout_random.Generate<u32>(0, in_numBillboards - 1);
+            default:
+                CS_LOG_FATAL("Invalid image selection type.");
+                return 0;
+            }
+        }
+        //-----------------------------------------------------------------------------
+        /// @author agent
         ///
-        /// @param The material.
+        /// @param The camera component.
+        /// @param [Out] The world space right vector of the camera.
+        /// @param [Out] The world space up vector of the camera.
+        //-----------------------------------------------------------------------------
+        void CalcCameraBasis(const CameraComponent* in_camera, Vector3& out_right, Vector3& out_up)
+        {
+            //billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
+            auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+            out_right = Vector3::Rotate(Vector3::k_unitPositiveX, inverseView);
+            out_up = Vector3::Rotate(Vector3::k_unitPositiveY, inverseView);
+        }
+        //-----------------------------------------------------------------------------
+        /// Writes the UVs and colour of the four vertices of a particle billboard.
+        /// The positions are calculated separately through billboard expansion.
+        ///
+        /// @author agent
+        ///
+        /// @param [Out] The four vertices of the quad.
         /// @param The uvs.
-        /// @param The local bottom left vertex position of the sprite.
-        /// @param The local top right vertex position of the sprite.
-        /// @param The world position of the sprite.
-        /// @param The world scale of the sprite.
-        /// @param The world orientation of the sprite.
         /// @param The colour of the sprite.
-        ///
-        /// @param The sprite data.
         //-----------------------------------------------------------------------------
-        SpriteBatch::SpriteData BuildSpriteData(const MaterialCSPtr& in_material, const UVs& in_uvs, const Vector2& in_localBL,
-            const Vector2& in_localTR, const Vector3& in_worldPosition, const Vector2& in_worldScale, const Quaternion& in_worldOrientation,
-            const Colour& in_colour)
+        void WriteQuadAttributes(SpriteBatch::SpriteVertex* out_vertices, const UVs& in_uvs, const Colour& in_colour)
         {
-            SpriteBatch::SpriteData spriteData;
-            spriteData.pMaterial = in_material;
+            SpriteBatch::SpriteVertex& topLeft = out_vertices[(u32)SpriteBatch::Verts::k_topLeft];
+            SpriteBatch::SpriteVertex& bottomLeft = out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft];
+            SpriteBatch::SpriteVertex& topRight = out_vertices[(u32)SpriteBatch::Verts::k_topRight];
+            SpriteBatch::SpriteVertex& bottomRight = out_vertices[(u32)SpriteBatch::Verts::k_bottomRight];
 
             //set the sprite colour
             ByteColour colour = ColourUtils::ColourToByteColour(in_colour);
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].Col = colour;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].Col = colour;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].Col = colour;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].Col = colour;
+            topLeft.Col = colour;
+            bottomLeft.Col = colour;
+            topRight.Col = colour;
+            bottomRight.Col = colour;
 
             //set the UVs.
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.x = in_uvs.m_u;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.y = in_uvs.m_v;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.x = in_uvs.m_u;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.y = in_uvs.m_v + in_uvs.m_t;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.y = in_uvs.m_v;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.y = in_uvs.m_v + in_uvs.m_t;
-
-            //Build the vertex data.
-            Vector3 localTopLeft(in_localBL.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-            Vector3 worldTopLeft = in_worldPosition + Vector3::Rotate(localTopLeft, in_worldOrientation);
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vPos = Vector4(worldTopLeft, 1.0f);
-
-            Vector3 localTopRight(in_localTR.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-            Vector3 worldTopRight = in_worldPosition + Vector3::Rotate(localTopRight, in_worldOrientation);
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vPos = Vector4(worldTopRight, 1.0f);
-
-            Vector3 localBottomLeft(in_localBL.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-            Vector3 worldBottomLeft = in_worldPosition + Vector3::Rotate(localBottomLeft, in_worldOrientation);
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Vector4(worldBottomLeft, 1.0f);
-
-            Vector3 localBottomRight(in_localTR.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-            Vector3 worldBottomRight = in_worldPosition + Vector3::Rotate(localBottomRight, in_worldOrientation);
-            spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Vector4(worldBottomRight, 1.0f);
-
-            return spriteData;
+            topLeft.vTex.x = in_uvs.m_u;
+            topLeft.vTex.y = in_uvs.m_v;
+            bottomLeft.vTex.x = in_uvs.m_u;
+            bottomLeft.vTex.y = in_uvs.m_v + in_uvs.m_t;
+            topRight.vTex.x = in_uvs.m_u + in_uvs.m_s;
+            topRight.vTex.y = in_uvs.m_v;
+            bottomRight.vTex.x = in_uvs.m_u + in_uvs.m_s;
+            bottomRight.vTex.y = in_uvs.m_v + in_uvs.m_t;
+        }
+        //-----------------------------------------------------------------------------
+        /// Expands the positions of all billboards in the given batch and then
+        /// empties it. The batch contains the billboards for the most recently
+        /// written quads.
+        ///
+        /// @author agent
+        ///
+        /// @param The batch of billboards.
+        /// @param The world space right vector of the camera.
+        /// @param The world space up vector of the camera.
+        /// @param The vertices of the quad buffer.
+        /// @param The number of quads that have been written, including those in
+        /// the batch.
+        //-----------------------------------------------------------------------------
+        void FlushBatch(ParticleBillboardExpansion::Batch& inout_batch, const Vector3& in_cameraRight, const Vector3& in_cameraUp, SpriteBatch::SpriteVertex* inout_vertices,
+            u32 in_numQuads)
+        {
+            ParticleBillboardExpansion::Expand(inout_batch, in_cameraRight, in_cameraUp, inout_vertices + (in_numQuads - inout_batch.m_size) * k_numSpriteVerts);
+            inout_batch.m_size = 0;
+        }
+        //-----------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The particle draw data.
+        /// @param The factor by which the position is interpolated from the previous
+        /// position.
+        ///
+        /// @return The position the particle should be drawn at.
+        //-----------------------------------------------------------------------------
+        Vector3 CalcDrawPosition(const ConcurrentParticleData::Particle& in_particle, f32 in_interpolationFactor)
+        {
+            if (in_interpolationFactor >= 1.0f)
+            {
+                return in_particle.m_position;
+            }
+
+            return Vector3::Lerp(in_particle.m_previousPosition, in_particle.m_position, in_interpolationFactor);
         }
     }
 
+    //-----------------------------------------------------------------------
+    /// Builds the camera independent vertex data for the billboards as part
+    /// of the background update. The billboard selection for each particle
+    /// is also performed here, so it is never required on the main thread.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class StaticBillboardParticleDrawable::VertexBuilder final : public ParticleVertexBuilder
+    {
+    public:
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param The billboards. These must not change after construction.
+        /// @param The image selection type.
+        /// @param The simulation space of the effect.
+        /// @param The maximum number of particles.
+        /// @param The memory manager per-particle data is allocated from.
+        //----------------------------------------------------------------
+        VertexBuilder(const std::shared_ptr<const dynamic_array<BillboardData>>& in_billboards, StaticBillboardParticleDrawableDef::ImageSelectionType in_imageSelectionType,
+            ParticleEffect::SimulationSpace in_simulationSpace, u32 in_maxParticles, ParticleMemoryManager* in_memoryManager);
+        //----------------------------------------------------------------
+        /// Selects the billboard for the newly emitted particle.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The index of the particle to activate.
+        //----------------------------------------------------------------
+        void ActivateParticle(const ParticleArray* in_particleArray, u32 in_index) override;
+        //----------------------------------------------------------------
+        /// Builds the vertex data for each visible particle.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The world position of the owning entity.
+        /// @param The world scale of the owning entity.
+        /// @param The world orientation of the owning entity.
+        /// @param [Out] The vertex data.
+        //----------------------------------------------------------------
+        void BuildVertexData(const ParticleArray* in_particleArray, const Vector3& in_entityPosition, const Vector3& in_entityScale, const Quaternion& in_entityOrientation,
+            ConcurrentParticleData::VertexData* out_vertexData) override;
+    private:
+        std::shared_ptr<const dynamic_array<BillboardData>> m_billboards;
+        StaticBillboardParticleDrawableDef::ImageSelectionType m_imageSelectionType;
+        ParticleEffect::SimulationSpace m_simulationSpace;
+        dynamic_array<u32> m_particleBillboardIndices;
+        u32 m_nextBillboardIndex = 0;
+        FastRandom m_random;
+    };
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    StaticBillboardParticleDrawable::VertexBuilder::VertexBuilder(const std::shared_ptr<const dynamic_array<BillboardData>>& in_billboards,
+        StaticBillboardParticleDrawableDef::ImageSelectionType in_imageSelectionType, ParticleEffect::SimulationSpace in_simulationSpace, u32 in_maxParticles, ParticleMemoryManager* in_memoryManager)
+        : m_billboards(in_billboards), m_imageSelectionType(in_imageSelectionType), m_simulationSpace(in_simulationSpace), m_particleBillboardIndices(in_memoryManager->AllocateArray<u32>(in_maxParticles))
+    {
+        m_particleBillboardIndices.fill(0);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::VertexBuilder::ActivateParticle(const ParticleArray* in_particleArray, u32 in_index)
+    {
+        const u32 slotIndex = in_particleArray->GetSlotIndices()[in_index];
+        CS_ASSERT(slotIndex < m_particleBillboardIndices.size(), "Index out of bounds!");
+
+        m_particleBillboardIndices[slotIndex] = SelectBillboard(m_imageSelectionType, u32(m_billboards->size()), m_nextBillboardIndex, m_random);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::VertexBuilder::BuildVertexData(const ParticleArray* in_particleArray, const Vector3& in_entityPosition, const Vector3& in_entityScale,
+        const Quaternion& in_entityOrientation, ConcurrentParticleData::VertexData* out_vertexData)
+    {
+        const bool isLocalSpace = (m_simulationSpace == ParticleEffect::SimulationSpace::k_local);
+        const auto entityWorldTransform = Matrix4::CreateTransform(in_entityPosition, in_entityScale, in_entityOrientation);
+
+        //a uniform scale is used for the same reason as when drawing local space particles on the render thread.
+        const f32 particleScaleFactor = (in_entityScale.x + in_entityScale.y + in_entityScale.z) / 3.0f;
+
+        const dynamic_array<u32>& slotIndices = in_particleArray->GetSlotIndices();
+        const dynamic_array<Vector3>& positions = in_particleArray->GetPositions();
+        const dynamic_array<f32>& rotations = in_particleArray->GetRotations();
+        const dynamic_array<Vector2>& scales = in_particleArray->GetScales();
+        const dynamic_array<Colour>& colours = in_particleArray->GetColours();
+
+        u32 numQuads = 0;
+        const u32 numParticles = in_particleArray->GetNumActiveParticles();
+        for (u32 i = 0; i < numParticles; ++i)
+        {
+            if (colours[i] != Colour::k_transparent)
+            {
+                Vector3 position = positions[i];
+                Vector2 scale = scales[i];
+                if (isLocalSpace == true)
+                {
+                    position = position * entityWorldTransform;
+                    scale = scale * particleScaleFactor;
+                }
+
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[slotIndices[i]]);
+                WriteQuadAttributes(out_vertexData->m_vertices.data() + numQuads * k_numSpriteVerts, billboardData.m_uvs, colours[i]);
+
+                auto& batch = out_vertexData->m_batches[numQuads / ParticleBillboardExpansion::k_maxBatchSize];
+                if (numQuads % ParticleBillboardExpansion::k_maxBatchSize == 0)
+                {
+                    batch.m_size = 0;
+                }
+                batch.Add(position, billboardData.m_bottomLeft * scale, billboardData.m_topRight * scale, rotations[i]);
+                ++numQuads;
+            }
+        }
+
+        out_vertexData->m_numQuads = numQuads;
+    }
     //----------------------------------------------
     //----------------------------------------------
     StaticBillboardParticleDrawable::StaticBillboardParticleDrawable(const Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData)
         : ParticleDrawable(in_entity, in_drawableDef, in_concurrentParticleData), m_billboardDrawableDef(static_cast<const StaticBillboardParticleDrawableDef*>(in_drawableDef)),
-        m_particleBillboardIndices(in_drawableDef->GetParticleEffect()->GetMaxParticles())
+        m_particleBillboardIndices(in_concurrentParticleData->GetMemoryManager()->AllocateArray<u32>(in_drawableDef->GetParticleEffect()->GetMaxParticles())), m_quadBuffer(Application::Get()->GetRenderSystem(), in_drawableDef->GetParticleEffect()->GetMaxParticles())
     {
         BuildBillboardImageData();
+
+        if (m_billboardDrawableDef->IsBackgroundVertexBuildingEnabled() == true)
+        {
+            const auto particleEffect = in_drawableDef->GetParticleEffect();
+            m_vertexBuilder = std::make_shared<VertexBuilder>(m_billboards, m_billboardDrawableDef->GetImageSelectionType(), particleEffect->GetSimulationSpace(), particleEffect->GetMaxParticles(),
+                in_concurrentParticleData->GetMemoryManager());
+        }
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -160,38 +347,54 @@ namespace ChilliSource
     {
         CS_ASSERT(in_index >= 0 && in_index < m_particleBillboardIndices.size(), "Index out of bounds!");
 
-        switch (m_billboardDrawableDef->GetImageSelectionType())
-        {
-        case StaticBillboardParticleDrawableDef::ImageSelectionType::k_cycle:
-            m_particleBillboardIndices[in_index] = m_nextBillboardIndex++;
-            if (m_nextBillboardIndex >= m_billboards->size())
-            {
-                m_nextBillboardIndex = 0;
-            }
-            break;
-        case StaticBillboardParticleDrawableDef::ImageSelectionType::k_random:
-            m_particleBillboardIndices[in_index] = Random::Generate<u32>(0, static_cast<s32>(m_billboards->size()) - 1);
-            break;
-        default:
-            CS_LOG_FATAL("Invalid image selection type.");
-            break;
-        }
+        m_particleBillboardIndices[in_index] = SelectBillboard(m_billboardDrawableDef->GetImageSelectionType(), u32(m_billboards->size()), m_nextBillboardIndex, m_random);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
+    void StaticBillboardParticleDrawable::DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera,
+        f32 in_interpolationFactor)
     {
+        u32 numQuads = 0;
         switch (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace())
         {
         case ParticleEffect::SimulationSpace::k_local:
-            DrawLocalSpace(in_particleData, in_camera);
+            numQuads = DrawLocalSpace(in_particleData, in_numParticles, in_camera, in_interpolationFactor);
             break;
         case ParticleEffect::SimulationSpace::k_world:
-            DrawWorldSpace(in_particleData, in_camera);
+            numQuads = DrawWorldSpace(in_particleData, in_numParticles, in_camera, in_interpolationFactor);
             break;
         default:
             CS_LOG_FATAL("Invalid simulation space.");
         }
+
+        m_quadBuffer.Render(m_billboardDrawableDef->GetMaterial(), numQuads);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleVertexBuilderSPtr StaticBillboardParticleDrawable::GetVertexBuilder() const
+    {
+        return m_vertexBuilder;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::DrawVertexData(const ConcurrentParticleData::VertexData& in_vertexData, const CameraComponent* in_camera)
+    {
+        const u32 numQuads = in_vertexData.m_numQuads;
+        CS_ASSERT(numQuads <= m_quadBuffer.GetMaxQuads(), "Too many quads in the vertex data.");
+
+        SpriteBatch::SpriteVertex* vertices = m_quadBuffer.GetVertices();
+        std::memcpy(vertices, in_vertexData.m_vertices.data(), numQuads * k_numSpriteVerts * sizeof(SpriteBatch::SpriteVertex));
+
+        Vector3 cameraRight, cameraUp;
+        CalcCameraBasis(in_camera, cameraRight, cameraUp);
+
+        const u32 numBatches = (numQuads + ParticleBillboardExpansion::k_maxBatchSize - 1) / ParticleBillboardExpansion::k_maxBatchSize;
+        for (u32 i = 0; i < numBatches; ++i)
+        {
+            ParticleBillboardExpansion::Expand(in_vertexData.m_batches[i], cameraRight, cameraUp, vertices + i * ParticleBillboardExpansion::k_maxBatchSize * k_numSpriteVerts);
+        }
+
+        m_quadBuffer.Render(m_billboardDrawableDef->GetMaterial(), numQuads);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -202,7 +405,7 @@ namespace ChilliSource
 
         if (textureAtlas != nullptr && atlasIds.empty() == false)
         {
-            m_billboards = std::unique_ptr<dynamic_array<BillboardData>>(new dynamic_array<BillboardData>(m_billboardDrawableDef->GetAtlasIds().size()));
+            m_billboards = std::make_shared<dynamic_array<BillboardData>>(m_billboardDrawableDef->GetAtlasIds().size());
             for (u32 i = 0; i < m_billboards->size(); ++i)
             {
                 const auto& frame = textureAtlas->GetFrame(m_billboardDrawableDef->GetAtlasIds()[i]);
@@ -231,7 +434,7 @@ namespace ChilliSource
             auto texture = m_billboardDrawableDef->GetMaterial()->GetTexture();
             CS_ASSERT(texture != nullptr, "Particle effect material cannot have no texture.");
 
-            m_billboards = std::unique_ptr<dynamic_array<BillboardData>>(new dynamic_array<BillboardData>(1));
+            m_billboards = std::make_shared<dynamic_array<BillboardData>>(1);
 
             Vector2 billboardSize = CalcBillboardSize(m_billboardDrawableDef->GetParticleSize(), Vector2(f32(texture->GetWidth()), f32(texture->GetHeight())),
                 m_billboardDrawableDef->GetSizePolicy());
@@ -250,9 +453,12 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+    u32 StaticBillboardParticleDrawable::DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera,
+        f32 in_interpolationFactor)
     {
-        const auto& material = m_billboardDrawableDef->GetMaterial();
+        SpriteBatch::SpriteVertex* vertices = m_quadBuffer.GetVertices();
+        u32 numQuads = 0;
+
         auto entityWorldTransform = GetEntity()->GetTransform().GetWorldTransform();
 
         //we can't directly apply the parent entities scale to the particles as this would look strange as
@@ -261,53 +467,67 @@ namespace ChilliSource
         auto entityScale = GetEntity()->GetTransform().GetWorldScale();
         f32 particleScaleFactor = (entityScale.x + entityScale.y + entityScale.z) / 3.0f;
 
-        //billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
-        auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+        Vector3 cameraRight, cameraUp;
+        CalcCameraBasis(in_camera, cameraRight, cameraUp);
 
-        for (u32 i = 0; i < in_particleData.size(); ++i)
+        ParticleBillboardExpansion::Batch batch;
+        for (u32 i = 0; i < in_numParticles; ++i)
         {
             const auto& particle = in_particleData[i];
 
-            if (particle.m_isActive == true && particle.m_colour != Colour::k_transparent)
+            if (particle.m_colour != Colour::k_transparent)
             {
-                auto worldPosition = particle.m_position * entityWorldTransform;
+                auto worldPosition = CalcDrawPosition(particle, in_interpolationFactor) * entityWorldTransform;
                 auto worldScale = particle.m_scale * particleScaleFactor;
 
-                //rotate locally in the XY plane before rotating to face the camera.
-                auto worldOrientation = Quaternion(Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
-                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-                auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, worldOrientation,
-                    particle.m_colour);
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_slotIndex]);
+                WriteQuadAttributes(vertices + numQuads * k_numSpriteVerts, billboardData.m_uvs, particle.m_colour);
+                batch.Add(worldPosition, billboardData.m_bottomLeft * worldScale, billboardData.m_topRight * worldScale, particle.m_rotation);
+                ++numQuads;
 
-                Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+                if (batch.m_size == ParticleBillboardExpansion::k_maxBatchSize)
+                {
+                    FlushBatch(batch, cameraRight, cameraUp, vertices, numQuads);
+                }
             }
         }
+
+        FlushBatch(batch, cameraRight, cameraUp, vertices, numQuads);
+
+        return numQuads;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+    u32 StaticBillboardParticleDrawable::DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera,
+        f32 in_interpolationFactor)
     {
-        const auto& material = m_billboardDrawableDef->GetMaterial();
+        SpriteBatch::SpriteVertex* vertices = m_quadBuffer.GetVertices();
+        u32 numQuads = 0;
 
-        //billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
-        auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+        Vector3 cameraRight, cameraUp;
+        CalcCameraBasis(in_camera, cameraRight, cameraUp);
 
-        for (u32 i = 0; i < in_particleData.size(); ++i)
+        ParticleBillboardExpansion::Batch batch;
+        for (u32 i = 0; i < in_numParticles; ++i)
         {
             const auto& particle = in_particleData[i];
 
-            if (particle.m_isActive == true && particle.m_colour != Colour::k_transparent)
+            if (particle.m_colour != Colour::k_transparent)
             {
-                //rotate locally in the XY plane before rotating to face the camera.
-                auto worldOrientation = Quaternion(Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
-                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-                auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale,
-                    worldOrientation, particle.m_colour);
-
-                Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_slotIndex]);
+                WriteQuadAttributes(vertices + numQuads * k_numSpriteVerts, billboardData.m_uvs, particle.m_colour);
+                batch.Add(CalcDrawPosition(particle, in_interpolationFactor), billboardData.m_bottomLeft * particle.m_scale, billboardData.m_topRight * particle.m_scale, particle.m_rotation);
+                ++numQuads;
+
+                if (batch.m_size == ParticleBillboardExpansion::k_maxBatchSize)
+                {
+                    FlushBatch(batch, cameraRight, cameraUp, vertices, numQuads);
+                }
             }
         }
+
+        FlushBatch(batch, cameraRight, cameraUp, vertices, numQuads);
+
+        return numQuads;
     }
 }
@@ -31,14 +31,24 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleQuadBuffer.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleVertexBuilder.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
 namespace ChilliSource
 {
     //-----------------------------------------------------------------------
-    /// A particle drawable for rendering particles as billboards.
+    /// A particle drawable for rendering particles as billboards. The
+    /// billboards are written directly into a quad buffer owned by the
+    /// drawable and rendered with a single draw call.
+    ///
+    /// If background vertex building is enabled in the drawable def, the
+    /// world positions, colours and UVs of the billboards are prepared by
+    /// a vertex builder during the background update, leaving only the
+    /// camera facing expansion to be performed when drawing.
     ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
@@ -59,6 +69,13 @@ namespace ChilliSource
             Vector2 m_topRight;
         };
         //----------------------------------------------------------------
+        /// The vertex builder used when background vertex building is
+        /// enabled.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        class VertexBuilder;
+        //----------------------------------------------------------------
         /// Constructor.
         ///
         /// @author Ian Copland
@@ -69,12 +86,12 @@ namespace ChilliSource
         //----------------------------------------------------------------
         StaticBillboardParticleDrawable(const Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData);
         //----------------------------------------------------------------
-        /// Activates the particle with the given index.
+        /// Activates the particle with the given slot index.
         ///
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
-        /// @param The index of the particle to activate.
+        /// @param The slot index of the particle to activate.
         //----------------------------------------------------------------
         void ActivateParticle(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) override;
         //----------------------------------------------------------------
@@ -83,9 +100,29 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
+        /// @param The number of active particles.
+        /// @param The camera component used to render.
+        /// @param The factor by which particle positions are interpolated
+        /// from their previous positions.
+        //----------------------------------------------------------------
+        void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera, f32 in_interpolationFactor) override;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The vertex builder if background vertex building is
+        /// enabled, otherwise null.
+        //----------------------------------------------------------------
+        ParticleVertexBuilderSPtr GetVertexBuilder() const override;
+        //----------------------------------------------------------------
+        /// Renders the particles from the vertex data built during the
+        /// background update.
+        ///
+        /// @author agent
+        ///
+        /// @param The prebuilt vertex data.
         /// @param The camera component used to render.
         //----------------------------------------------------------------
-        void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) override;
+        void DrawVertexData(const ConcurrentParticleData::VertexData& in_vertexData, const CameraComponent* in_camera) override;
         //----------------------------------------------------------------
         /// Builds the billboard image data from the provided texture
         /// or texture atlas.
@@ -102,31 +139,46 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void PrepareParticleBillboardIndices();
         //----------------------------------------------------------------
-        /// Draws the particles taking into account the world space
-        /// transform of the owning entity.
+        /// Writes a billboard quad for each visible particle to the quad
+        /// buffer, taking into account the world space transform of the
+        /// owning entity.
         ///
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
+        /// @param The number of active particles.
         /// @param The camera component used to render.
+        /// @param The factor by which particle positions are interpolated
+        /// from their previous positions.
+        ///
+        /// @return The number of quads written to the quad buffer.
         //----------------------------------------------------------------
-        void DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+        u32 DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera, f32 in_interpolationFactor);
         //----------------------------------------------------------------
-        /// Draws the particles without taking into account the world
-        /// space transform of the owning entity as the particles are
-        /// already in world space.
+        /// Writes a billboard quad for each visible particle to the quad
+        /// buffer, without taking into account the world space transform
+        /// of the owning entity as the particles are already in world
+        /// space.
         ///
         /// @author Ian Copland
         ///
         /// @param The particle draw data.
+        /// @param The number of active particles.
         /// @param The camera component used to render.
+        /// @param The factor by which particle positions are interpolated
+        /// from their previous positions.
+        ///
+        /// @return The number of quads written to the quad buffer.
         //----------------------------------------------------------------
-        void DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+        u32 DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_numParticles, const CameraComponent* in_camera, f32 in_interpolationFactor);
 
         const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
-        std::unique_ptr <dynamic_array<BillboardData>> m_billboards;
+        std::shared_ptr<dynamic_array<BillboardData>> m_billboards;
         dynamic_array<u32> m_particleBillboardIndices;
         u32 m_nextBillboardIndex = 0;
+        FastRandom m_random;
+        ParticleQuadBuffer m_quadBuffer;
+        ParticleVertexBuilderSPtr m_vertexBuilder;
     };
 }
 
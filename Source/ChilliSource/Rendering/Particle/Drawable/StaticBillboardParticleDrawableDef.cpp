@@ -86,15 +86,15 @@ namespace ChilliSource
     CS_DEFINE_NAMEDTYPE(StaticBillboardParticleDrawableDef);
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding)
+        : m_material(in_material), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_backgroundVertexBuilding(in_backgroundVertexBuilding)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
     }
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding)
+        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_backgroundVertexBuilding(in_backgroundVertexBuilding)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
         CS_ASSERT(m_textureAtlas != nullptr, "Cannot create a Billboard Particle Drawable Def with a null texture atlas.");
@@ -103,8 +103,8 @@ namespace ChilliSource
     }
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_atlasIds(in_atlasIds), m_imageSelectionType(in_imageSelectionType), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding)
+        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_atlasIds(in_atlasIds), m_imageSelectionType(in_imageSelectionType), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_backgroundVertexBuilding(in_backgroundVertexBuilding)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
         CS_ASSERT(m_textureAtlas != nullptr, "Cannot create a Billboard Particle Drawable Def with a null texture atlas.");
@@ -137,6 +137,14 @@ namespace ChilliSource
             m_sizePolicy = ParseSizePolicy(jsonValue.asString());
         }
 
+        //Background vertex building
+        jsonValue = in_paramsJson.get("BackgroundVertexBuilding", Json::nullValue);
+        if (jsonValue.isNull() == false)
+        {
+            CS_ASSERT(jsonValue.isString(), "background vertex building must be a string.");
+            m_backgroundVertexBuilding = ParseBool(jsonValue.asString());
+        }
+
         //load the resources.
         if (in_asyncDelegate == nullptr)
         {
@@ -195,6 +203,12 @@ namespace ChilliSource
     {
         return m_sizePolicy;
     }
+    //--------------------------------------------------
+    //--------------------------------------------------
+    bool StaticBillboardParticleDrawableDef::IsBackgroundVertexBuildingEnabled() const
+    {
+        return m_backgroundVertexBuilding;
+    }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void StaticBillboardParticleDrawableDef::LoadResources(const Json::Value& in_paramsJson)
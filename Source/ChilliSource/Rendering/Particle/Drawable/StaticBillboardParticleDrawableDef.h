@@ -78,6 +78,13 @@ namespace ChilliSource
     /// “UseHeightMaintainingAspect”, “UsePreferredSize”,
     /// “UseWidthMaintainingAspect”
     ///
+    /// "BackgroundVertexBuilding": Whether or not the camera independent
+    /// vertex data, such as the world positions, colours and UVs, should
+    /// be built as part of the background particle update rather than on
+    /// the render thread. Local space effects will use the transform of
+    /// the owning entity at the time of the update, so this should only
+    /// be enabled if this is acceptable. Defaults to "false".
+    ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
     class StaticBillboardParticleDrawableDef final : public ParticleDrawableDef
@@ -107,8 +114,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param Whether or not the camera independent vertex data should
+        /// be built as part of the background update. Defaults to false.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding = false);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable definition
         /// which uses a texture atlas and multiple atlas Ids.
@@ -123,8 +132,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered 
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param Whether or not the camera independent vertex data should
+        /// be built as part of the background update. Defaults to false.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding = false);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable 
         /// definition which uses a texture atlas and multiple atlas Ids.
@@ -141,8 +152,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param Whether or not the camera independent vertex data should
+        /// be built as part of the background update. Defaults to false.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy, bool in_backgroundVertexBuilding = false);
         //----------------------------------------------------------------
         /// Constructor. Loads the params for the drawable def from the 
         /// given json params. If the async delegate is not null, then
@@ -221,6 +234,13 @@ namespace ChilliSource
         /// ratio.
         //----------------------------------------------------------------
         SizePolicy GetSizePolicy() const;
+        //----------------------------------------------------------------
+        /// @author agent.
+        ///
+        /// @return Whether or not the camera independent vertex data
+        /// should be built as part of the background update.
+        //----------------------------------------------------------------
+        bool IsBackgroundVertexBuildingEnabled() const;
     private:
         //----------------------------------------------------------------
         /// Loads the billboard resources on the main thread.
@@ -247,6 +267,7 @@ namespace ChilliSource
         ImageSelectionType m_imageSelectionType = ImageSelectionType::k_cycle;
         Vector2 m_particleSize = Vector2::k_one;
         SizePolicy m_sizePolicy = SizePolicy::k_none;
+        bool m_backgroundVertexBuilding = false;
     };
 }
 
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitterDef.h>
 
@@ -41,18 +41,20 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param [In/Out] The random number generator.
+        ///
         /// @return A random point in a unit circle.
         //----------------------------------------------------------------
-        Vector2 GeneratePointInUnitCircle()
+        Vector2 GeneratePointInUnitCircle(FastRandom& inout_random)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return Random::GenerateDirection2D<f32>() * dist;
+            f32 dist = std::sqrt(inout_random.GenerateNormalised<f32>());
+            return inout_random.GenerateDirection2D<f32>() * dist;
         }
     }
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
+    CircleParticleEmitter::CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray)
         : ParticleEmitter(in_particleEmitter, in_particleArray)
     {
         //Only the circle emitter def can create this, so this is safe.
@@ -62,16 +64,16 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void CircleParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_circleParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
+        f32 radius = m_circleParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
 
         //calculate the position.
         switch (m_circleParticleEmitterDef->GetEmitFromType())
         {
         case CircleParticleEmitterDef::EmitFromType::k_inside:
-            out_position = Vector3(GeneratePointInUnitCircle() * radius, 0.0f);
+            out_position = Vector3(GeneratePointInUnitCircle(GetRandom()) * radius, 0.0f);
             break;
         case CircleParticleEmitterDef::EmitFromType::k_surface:
-            out_position = Vector3(Random::GenerateDirection2D<f32>() * radius, 0.0f);
+            out_position = Vector3(GetRandom().GenerateDirection2D<f32>() * radius, 0.0f);
             break;
         default:
             CS_LOG_FATAL("Invalid 'Emit From' type.");
@@ -82,7 +84,7 @@ namespace ChilliSource
         switch (m_circleParticleEmitterDef->GetEmitDirectionType())
         {
         case CircleParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Vector3(Random::GenerateDirection2D<f32>(), 0.0f);
+            out_direction = Vector3(GetRandom().GenerateDirection2D<f32>(), 0.0f);
             break;
         case CircleParticleEmitterDef::EmitDirectionType::k_awayFromCentre:
             out_direction = Vector3::Normalise(out_position);
@@ -145,7 +145,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr CircleParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr CircleParticleEmitterDef::CreateInstance(ParticleArray* in_particleArray) const
     {
         return ParticleEmitterUPtr(new CircleParticleEmitter(this, in_particleArray));
     }
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitterDef.h>
 
@@ -45,12 +45,13 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GenerateDirectionWithinAngle(f32 in_angle)
+        Vector2 GenerateDirectionWithinAngle(f32 in_angle, FastRandom& inout_random)
         {
-            f32 angle = MathUtils::k_pi * 0.5f + Random::GenerateNormalised<f32>() * in_angle - 0.5f * in_angle;
+            f32 angle = MathUtils::k_pi * 0.5f + inout_random.GenerateNormalised<f32>() * in_angle - 0.5f * in_angle;
             Vector2 direction(std::cos(angle), std::sin(angle));
             return direction;
         }
@@ -61,13 +62,14 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GenerateDirectionWithAngle(f32 in_angle)
+        Vector2 GenerateDirectionWithAngle(f32 in_angle, FastRandom& inout_random)
         {
             f32 angle = 0.0f;
-            if (Random::Generate<u32>(0, 1) == 0)
+            if (inout_random.Generate<u32>(0, 1) == 0)
             {
                 angle = MathUtils::k_pi * 0.5f - 0.5f * in_angle;
             }
@@ -85,13 +87,14 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The position.
         //----------------------------------------------------------------
-        Vector2 GeneratePositionInUnitCone2D(f32 in_angle)
+        Vector2 GeneratePositionInUnitCone2D(f32 in_angle, FastRandom& inout_random)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return GenerateDirectionWithinAngle(in_angle) * dist;
+            f32 dist = std::sqrt(inout_random.GenerateNormalised<f32>());
+            return GenerateDirectionWithinAngle(in_angle, inout_random) * dist;
         }
         //----------------------------------------------------------------
         /// Generates a position on a the surface of a unit 2D cone with the
@@ -100,19 +103,20 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GeneratePositionOnUnitCone2D(f32 in_angle)
+        Vector2 GeneratePositionOnUnitCone2D(f32 in_angle, FastRandom& inout_random)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return GenerateDirectionWithAngle(in_angle) * dist;
+            f32 dist = std::sqrt(inout_random.GenerateNormalised<f32>());
+            return GenerateDirectionWithAngle(in_angle, inout_random) * dist;
         }
     }
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
+    Cone2DParticleEmitter::Cone2DParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray)
         : ParticleEmitter(in_particleEmitter, in_particleArray)
     {
         //Only the sphere emitter def can create this, so this is safe.
@@ -122,17 +126,17 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void Cone2DParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
-        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime);
+        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
+        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
 
         //calculate the position.
         switch (m_coneParticleEmitterDef->GetEmitFromType())
         {
         case Cone2DParticleEmitterDef::EmitFromType::k_inside:
-            out_position = Vector3(GeneratePositionInUnitCone2D(angle) * radius, 0.0f);
+            out_position = Vector3(GeneratePositionInUnitCone2D(angle, GetRandom()) * radius, 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitFromType::k_edge:
-            out_position = Vector3(GeneratePositionOnUnitCone2D(angle) * radius, 0.0f);
+            out_position = Vector3(GeneratePositionOnUnitCone2D(angle, GetRandom()) * radius, 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitFromType::k_base:
             out_position = Vector3::k_zero;
@@ -146,7 +150,7 @@ namespace ChilliSource
         switch (m_coneParticleEmitterDef->GetEmitDirectionType())
         {
         case Cone2DParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Vector3(GenerateDirectionWithinAngle(angle), 0.0f);
+            out_direction = Vector3(GenerateDirectionWithinAngle(angle, GetRandom()), 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitDirectionType::k_awayFromBase:
             if (out_position != Vector3::k_zero)
@@ -155,7 +159,7 @@ namespace ChilliSource
             }
             else
             {
-                out_direction = Vector3(GenerateDirectionWithinAngle(angle), 0.0f);
+                out_direction = Vector3(GenerateDirectionWithinAngle(angle, GetRandom()), 0.0f);
             }
             break;
         default:
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitterDef.h>
 
@@ -45,18 +45,19 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GenerateDirectionWithinAngle(f32 in_angle)
+        Vector3 GenerateDirectionWithinAngle(f32 in_angle, FastRandom& inout_random)
         {
             //get the y value that would ensure the top of the cone is a circle of unit radius.
             f32 y = 1.0f / tan(in_angle * 0.5f);
 
             //get a random point within the circle at the top of the cone. the square root of the
             //random distance is used to acheive even distribution.
-            Vector2 topDirection = Random::GenerateDirection2D<f32>();
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
+            Vector2 topDirection = inout_random.GenerateDirection2D<f32>();
+            f32 dist = std::sqrt(inout_random.GenerateNormalised<f32>());
 
             //normalise this to get a direction vector.
             Vector3 output(topDirection.x * dist, y, topDirection.y * dist);
@@ -70,16 +71,17 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GenerateDirectionWithAngle(f32 in_angle)
+        Vector3 GenerateDirectionWithAngle(f32 in_angle, FastRandom& inout_random)
         {
             //get the y value that would ensure the top of the cone is a circle of unit radius.
             f32 y = 1.0f / tan(in_angle * 0.5f);
 
             //get a random point on the surface the circle at the top of the cone.
-            Vector2 topDirection = Random::GenerateDirection2D<f32>();
+            Vector2 topDirection = inout_random.GenerateDirection2D<f32>();
 
             //normalise this to get a direction vector.
             Vector3 output(topDirection.x, y, topDirection.y);
@@ -93,15 +95,16 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The position.
         //----------------------------------------------------------------
-        Vector3 GeneratePositionInUnitCone(f32 in_angle)
+        Vector3 GeneratePositionInUnitCone(f32 in_angle, FastRandom& inout_random)
         {
             const f32 oneOverThree = 1.0f / 3.0f;
 
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), oneOverThree);
-            return GenerateDirectionWithinAngle(in_angle) * dist;
+            f32 dist = std::pow(inout_random.GenerateNormalised<f32>(), oneOverThree);
+            return GenerateDirectionWithinAngle(in_angle, inout_random) * dist;
         }
         //----------------------------------------------------------------
         /// Generates a position on a the surface of a unit cone with the
@@ -110,21 +113,22 @@ namespace ChilliSource
         /// @author Ian Copland
         ///
         /// @param The angle.
+        /// @param [In/Out] The random number generator.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GeneratePositionOnUnitCone(f32 in_angle)
+        Vector3 GeneratePositionOnUnitCone(f32 in_angle, FastRandom& inout_random)
         {
             const f32 oneOverThree = 1.0f / 3.0f;
 
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), oneOverThree);
-            return GenerateDirectionWithAngle(in_angle) * dist;
+            f32 dist = std::pow(inout_random.GenerateNormalised<f32>(), oneOverThree);
+            return GenerateDirectionWithAngle(in_angle, inout_random) * dist;
         }
     }
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
+    ConeParticleEmitter::ConeParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray)
         : ParticleEmitter(in_particleEmitter, in_particleArray)
     {
         //Only the sphere emitter def can create this, so this is safe.
@@ -134,17 +138,17 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void ConeParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
-        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime);
+        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
+        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
 
         //calculate the position.
         switch (m_coneParticleEmitterDef->GetEmitFromType())
         {
         case ConeParticleEmitterDef::EmitFromType::k_inside:
-            out_position = GeneratePositionInUnitCone(angle) * radius;
+            out_position = GeneratePositionInUnitCone(angle, GetRandom()) * radius;
             break;
         case ConeParticleEmitterDef::EmitFromType::k_surface:
-            out_position = GeneratePositionOnUnitCone(angle) * radius;
+            out_position = GeneratePositionOnUnitCone(angle, GetRandom()) * radius;
             break;
         case ConeParticleEmitterDef::EmitFromType::k_base:
             out_position = Vector3::k_zero;
@@ -158,7 +162,7 @@ namespace ChilliSource
         switch (m_coneParticleEmitterDef->GetEmitDirectionType())
         {
         case ConeParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = GenerateDirectionWithinAngle(angle);
+            out_direction = GenerateDirectionWithinAngle(angle, GetRandom());
             break;
         case ConeParticleEmitterDef::EmitDirectionType::k_awayFromBase:
             if (out_position != Vector3::k_zero)
@@ -167,7 +171,7 @@ namespace ChilliSource
             }
             else
             {
-                out_direction = GenerateDirectionWithinAngle(angle);
+                out_direction = GenerateDirectionWithinAngle(angle, GetRandom());
             }
             break;
         default:
@@ -31,8 +31,7 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/Transform.h>
-#include <ChilliSource/Core/Math/Random.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
@@ -42,17 +41,22 @@ namespace ChilliSource
 {
     //----------------------------------------------
     //----------------------------------------------
-    ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, dynamic_array<Particle>* in_particleArray)
-        : m_emitterDef(in_emitterDef), m_particleArray(in_particleArray)
+    ParticleEmitter::ParticleEmitter(const ParticleEmitterDef* in_emitterDef, ParticleArray* in_particleArray)
+        : m_emitterDef(in_emitterDef), m_particleArray(in_particleArray), m_numDroppedEmissions(0)
     {
         CS_ASSERT(m_emitterDef != nullptr, "Cannot create particle emitter with null emitter def.");
         CS_ASSERT(m_particleArray != nullptr, "Cannot create particle emitter with null particle array.");
     }
     //----------------------------------------------
     //----------------------------------------------
-    std::vector<u32> ParticleEmitter::TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission)
+    std::vector<u32> ParticleEmitter::TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission,
+        f32 in_emissionRateScale, f32 in_maxParticlesScale)
     {
         CS_ASSERT(in_playbackTime >= 0.0f, "Playback time cannot be below zero.");
+        CS_ASSERT(in_emissionRateScale >= 0.0f && in_maxParticlesScale >= 0.0f, "Emission scales cannot be negative.");
+
+        m_emissionRateScale = in_emissionRateScale;
+        m_particleLimit = std::min(u32(f32(m_particleArray->GetCapacity()) * in_maxParticlesScale + 0.5f), m_particleArray->GetCapacity());
 
         //If this is the first emission, then setup the correct entity positions.
         if (in_interpolateEmission == false)
@@ -84,10 +88,34 @@ namespace ChilliSource
     }
     //----------------------------------------------
     //----------------------------------------------
+    void ParticleEmitter::Reset()
+    {
+        m_emissionPosition = Vector3::k_zero;
+        m_emissionScale = Vector3::k_zero;
+        m_emissionOrientation = Quaternion::k_identity;
+        m_emissionTime = 0.0f;
+        m_hasEmitted = false;
+        m_emissionRateScale = 1.0f;
+        m_particleLimit = 0;
+    }
+    //----------------------------------------------
+    //----------------------------------------------
+    u32 ParticleEmitter::GetNumDroppedEmissions() const
+    {
+        return m_numDroppedEmissions;
+    }
+    //----------------------------------------------
+    //----------------------------------------------
     const ParticleEmitterDef* ParticleEmitter::GetEmitterDef() const
     {
         return m_emitterDef;
     }
+    //----------------------------------------------
+    //----------------------------------------------
+    FastRandom& ParticleEmitter::GetRandom()
+    {
+        return m_random;
+    }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     std::vector<u32> ParticleEmitter::TryEmitStream(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation)
@@ -99,7 +127,14 @@ namespace ChilliSource
         //Get the time between emissions at this stage in the playback timer. Note that this doesn't take into account
         //the interpolation between the last frame and this, but should be close enough.
         const f32 normalisedPlaybackTime = in_playbackTime / particleEffect->GetDuration();
-        const f32 timeBetweenEmissions = 1.0f / m_emitterDef->GetEmissionRateProperty()->GenerateValue(normalisedPlaybackTime);
+        const f32 emissionRate = m_emitterDef->GetEmissionRateProperty()->GenerateValue(normalisedPlaybackTime, m_random) * m_emissionRateScale;
+        if (emissionRate <= 0.0f)
+        {
+            m_emissionTime = in_playbackTime;
+            return emittedParticles;
+        }
+
+        const f32 timeBetweenEmissions = 1.0f / emissionRate;
 
         f32 prevEmissionTime = m_emissionTime;
         Vector3 prevEntityPosition = m_emissionPosition;
@@ -107,6 +142,15 @@ namespace ChilliSource
         Quaternion prevOrientation = m_emissionOrientation;
 
         f32 nextEmissionTime = prevEmissionTime + timeBetweenEmissions;
+
+        //reserve for the expected number of emissions up front, assuming one particle per emission and
+        //capped to the free space in the particle array. Emissions beyond this grow the capacity in EmitBatch.
+        if (nextEmissionTime <= in_playbackTime)
+        {
+            const f32 numEmissions = (in_playbackTime - prevEmissionTime) / timeBetweenEmissions;
+            const u32 numFree = m_particleArray->GetCapacity() - m_particleArray->GetNumActiveParticles();
+            emittedParticles.reserve(std::size_t(std::min(numEmissions, f32(numFree))));
+        }
         
         while (nextEmissionTime <= in_playbackTime)
         {
@@ -123,16 +167,10 @@ namespace ChilliSource
             }
             CS_ASSERT(normalisedEmissionTime >= 0.0f && normalisedEmissionTime <= 1.0f, "Invalid emission time.");
             
-            u32 particlesPerEmission = m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedEmissionTime);
-            for (u32 i = 0; i < particlesPerEmission; ++i)
-            {
-                f32 chanceOfEmission = m_emitterDef->GetEmissionChanceProperty()->GenerateValue(normalisedEmissionTime);
-                f32 random = Random::GenerateNormalised<f32>();
-                if (random <= chanceOfEmission)
-                {
-                    Emit(normalisedEmissionTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
-                }
-            }
+            u32 particlesPerEmission = m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedEmissionTime, m_random);
+            u32 numToEmit = CalcNumToEmit(particlesPerEmission, normalisedEmissionTime);
+
+            EmitBatch(numToEmit, normalisedEmissionTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
 
             nextEmissionTime += timeBetweenEmissions;
         }
@@ -154,89 +192,149 @@ namespace ChilliSource
             m_emissionOrientation = in_emitterOrientation;
 
             const f32 normalisedPlaybackTime = 0.0f;
-            u32 particlesPerEmission = m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedPlaybackTime);
-            for (u32 i = 0; i < particlesPerEmission; ++i)
+            u32 particlesPerEmission = u32(f32(m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedPlaybackTime, m_random)) * m_emissionRateScale + 0.5f);
+            u32 numToEmit = CalcNumToEmit(particlesPerEmission, normalisedPlaybackTime);
+
+            EmitBatch(numToEmit, normalisedPlaybackTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
+
+            m_hasEmitted = true;
+        }
+
+        return emittedParticles;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleEmitter::CalcNumToEmit(u32 in_numAttempts, f32 in_normalisedEmissionTime)
+    {
+        const u32 k_maxBatchSize = 64;
+        f32 emissionTimes[k_maxBatchSize];
+        std::fill_n(emissionTimes, k_maxBatchSize, in_normalisedEmissionTime);
+
+        f32 chancesOfEmission[k_maxBatchSize];
+        f32 randomValues[k_maxBatchSize];
+
+        u32 numToEmit = 0;
+        for (u32 batchStart = 0; batchStart < in_numAttempts; batchStart += k_maxBatchSize)
+        {
+            const u32 batchSize = std::min(k_maxBatchSize, in_numAttempts - batchStart);
+
+            m_emitterDef->GetEmissionChanceProperty()->GenerateValues(emissionTimes, batchSize, m_random, chancesOfEmission);
+            m_random.FillNormalised(randomValues, batchSize);
+
+            for (u32 i = 0; i < batchSize; ++i)
             {
-                f32 chanceOfEmission = m_emitterDef->GetEmissionChanceProperty()->GenerateValue(normalisedPlaybackTime);
-                f32 random = Random::GenerateNormalised<f32>();
-                if (random <= chanceOfEmission)
+                if (randomValues[i] <= chancesOfEmission[i])
                 {
-                    Emit(normalisedPlaybackTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
+                    ++numToEmit;
                 }
             }
-
-            m_hasEmitted = true;
         }
 
-        return emittedParticles;
+        return numToEmit;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void ParticleEmitter::Emit(f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles)
+    void ParticleEmitter::EmitBatch(u32 in_numParticles, f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles)
     {
         const ParticleEffect* particleEffect = m_emitterDef->GetParticleEffect();
 
-        u32 particleIndex = m_nextParticleIndex++;
-        Particle& particle = m_particleArray->at(particleIndex);
-        if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
+        const u32 numActive = m_particleArray->GetNumActiveParticles();
+        const u32 numFree = m_particleArray->GetCapacity() - numActive;
+        if (numFree < in_numParticles)
         {
-            m_nextParticleIndex = 0;
+            m_numDroppedEmissions += in_numParticles - numFree;
         }
 
-        if (particle.m_isActive == false)
+        //emissions over the level of detail particle limit are intentional so aren't counted as dropped.
+        const u32 numAllowed = (m_particleLimit > numActive) ? m_particleLimit - numActive : 0;
+
+        //emissions throttled by the global particle budget are counted by the particle memory manager.
+        const u32 numToEmit = m_particleArray->ReserveParticles(std::min(in_numParticles, numAllowed), particleEffect->GetPriority());
+
+        if (numToEmit == 0)
         {
-            inout_emittedParticles.push_back(particleIndex);
+            return;
+        }
 
-            //Get the emission position and direction.
-            Vector3 localPosition;
-            Vector3 localDirection;
-            GenerateEmission(in_normalisedEmissionTime, localPosition, localDirection);
+        //streams call this once per emission, so the capacity is grown geometrically rather than to the exact size to avoid reallocating every time.
+        const std::size_t requiredCapacity = inout_emittedParticles.size() + numToEmit;
+        if (requiredCapacity > inout_emittedParticles.capacity())
+        {
+            inout_emittedParticles.reserve(std::max(requiredCapacity, 2 * inout_emittedParticles.capacity()));
+        }
+
+        //we can't directly apply the emission scale to the particles as this would look strange as
+        //the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
+        //scale from the average of the components.
+        const bool isWorldSpace = (particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world);
+        const Matrix4 worldTransform = Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
+        const f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
+
+        const u32 k_maxBatchSize = 64;
+        f32 emissionTimes[k_maxBatchSize];
+        std::fill_n(emissionTimes, k_maxBatchSize, in_normalisedEmissionTime);
+
+        Vector2 localScales[k_maxBatchSize];
+        f32 localRotations[k_maxBatchSize];
+        f32 localSpeeds[k_maxBatchSize];
+        f32 lifetimes[k_maxBatchSize];
+        Colour colours[k_maxBatchSize];
+        f32 angularVelocities[k_maxBatchSize];
+
+        dynamic_array<Vector3>& positions = m_particleArray->GetPositions();
+        dynamic_array<Vector3>& previousPositions = m_particleArray->GetPreviousPositions();
+        dynamic_array<Vector2>& scales = m_particleArray->GetScales();
+        dynamic_array<Vector3>& velocities = m_particleArray->GetVelocities();
+        dynamic_array<f32>& particleLifetimes = m_particleArray->GetLifetimes();
+        dynamic_array<f32>& energies = m_particleArray->GetEnergies();
+        dynamic_array<Colour>& particleColours = m_particleArray->GetColours();
+        dynamic_array<f32>& rotations = m_particleArray->GetRotations();
+        dynamic_array<f32>& particleAngularVelocities = m_particleArray->GetAngularVelocities();
+
+        for (u32 batchStart = 0; batchStart < numToEmit; batchStart += k_maxBatchSize)
+        {
+            const u32 batchSize = std::min(k_maxBatchSize, numToEmit - batchStart);
 
-            //calculate the local space properties.
-            Vector2 localScale = particleEffect->GetInitialScaleProperty()->GenerateValue(in_normalisedEmissionTime);
-            f32 localRotation = particleEffect->GetInitialRotationProperty()->GenerateValue(in_normalisedEmissionTime);
-            f32 localSpeed = particleEffect->GetInitialSpeedProperty()->GenerateValue(in_normalisedEmissionTime);
+            //generate the initial properties for the whole batch.
+            particleEffect->GetInitialScaleProperty()->GenerateValues(emissionTimes, batchSize, m_random, localScales);
+            particleEffect->GetInitialRotationProperty()->GenerateValues(emissionTimes, batchSize, m_random, localRotations);
+            particleEffect->GetInitialSpeedProperty()->GenerateValues(emissionTimes, batchSize, m_random, localSpeeds);
+            particleEffect->GetLifetimeProperty()->GenerateValues(emissionTimes, batchSize, m_random, lifetimes);
+            particleEffect->GetInitialColourProperty()->GenerateValues(emissionTimes, batchSize, m_random, colours);
+            particleEffect->GetInitialAngularVelocityProperty()->GenerateValues(emissionTimes, batchSize, m_random, angularVelocities);
 
-            //apply these in the correct simulation space.
-            switch (particleEffect->GetSimulationSpace())
+            for (u32 i = 0; i < batchSize; ++i)
             {
-                case ParticleEffect::SimulationSpace::k_world:
-                {
-                    //transform the position into world space.
-                    const Matrix4 worldTransform = Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
-                    particle.m_position = localPosition * worldTransform;
-
-                    //we can't directly apply the emission scale to the particles as this would look strange as
-                    //the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
-                    //scale from the average of the components.
-                    f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
-                    particle.m_scale = localScale * particleScaleFactor;
-
-                    //transform the velocity into world space.
-                    particle.m_velocity = Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
-                    break;
-                }
-                case ParticleEffect::SimulationSpace::k_local:
+                u32 particleIndex = m_particleArray->AddParticle();
+                inout_emittedParticles.push_back(particleIndex);
+
+                //Get the emission position and direction.
+                Vector3 localPosition;
+                Vector3 localDirection;
+                GenerateEmission(in_normalisedEmissionTime, localPosition, localDirection);
+
+                //apply these in the correct simulation space.
+                if (isWorldSpace == true)
                 {
-                    particle.m_position = localPosition;
-                    particle.m_scale = localScale;
-                    particle.m_velocity = localDirection * localSpeed;
-                    break;
+                    positions[particleIndex] = localPosition * worldTransform;
+                    scales[particleIndex] = localScales[i] * particleScaleFactor;
+                    velocities[particleIndex] = Vector3::Rotate(((localDirection * localSpeeds[i]) * in_emissionScale), in_emissionOrientation);
                 }
-                default:
+                else
                 {
-                    CS_LOG_FATAL("Invalid simulation space.");
-                    break;
+                    positions[particleIndex] = localPosition;
+                    scales[particleIndex] = localScales[i];
+                    velocities[particleIndex] = localDirection * localSpeeds[i];
                 }
-            }
 
-            //apply the remaining properties.
-            particle.m_lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
-            particle.m_energy = particle.m_lifetime;
-            particle.m_colour = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
-            particle.m_rotation = localRotation;
-            particle.m_angularVelocity = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
-            particle.m_isActive = true;
+                //apply the remaining properties.
+                previousPositions[particleIndex] = positions[particleIndex];
+                particleLifetimes[particleIndex] = lifetimes[i];
+                energies[particleIndex] = lifetimes[i];
+                particleColours[particleIndex] = colours[i];
+                rotations[particleIndex] = localRotations[i];
+                particleAngularVelocities[particleIndex] = angularVelocities[i];
+            }
         }
     }
-}
\ No newline at end of file
+}
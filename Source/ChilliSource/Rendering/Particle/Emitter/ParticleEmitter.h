@@ -30,9 +30,11 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_EMITTER_PARTICLEEMITTER_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 
+#include <atomic>
 #include <random>
 #include <vector>
 
@@ -60,7 +62,7 @@ namespace ChilliSource
         /// @param The particle emitter definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray);
         //----------------------------------------------------------------
         /// Tries to emit new particles if required. This will be called 
         /// as part of a background task.
@@ -73,10 +75,38 @@ namespace ChilliSource
         /// @param The current world space orientation of the emitter.
         /// @param Whether or not to interpolate the emission position
         /// since the last frame.
+        /// @param The scale applied to the emission rate of a stream
+        /// emitter, or the number of particles emitted by a burst.
+        /// @param The scale applied to the max number of particles that
+        /// can be active. Emissions prevented by this are not counted as
+        /// dropped.
         ///
         /// @return The list of newly emitted particle indices.
         //----------------------------------------------------------------
-        std::vector<u32> TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission);
+        std::vector<u32> TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission,
+            f32 in_emissionRateScale, f32 in_maxParticlesScale);
+        //----------------------------------------------------------------
+        /// Resets the emission state so the emitter behaves as though it
+        /// had just been created. This is used when an emitter is reused
+        /// by a new playback of its particle effect. This must not be
+        /// called while a particle update is in progress.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void Reset();
+        //----------------------------------------------------------------
+        /// Returns the number of emissions that have been dropped because
+        /// the particle array was full at the time of emission. This can
+        /// be used to decide whether or not the max particles for an
+        /// effect is sized correctly.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @return The number of dropped emissions.
+        //----------------------------------------------------------------
+        u32 GetNumDroppedEmissions() const;
         //----------------------------------------------------------------
         /// Destructor.
         ///
@@ -91,6 +121,17 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const ParticleEmitterDef* GetEmitterDef() const;
         //----------------------------------------------------------------
+        /// The emitter's own random number generator. This is seeded
+        /// independently for each emitter and is only used from within
+        /// the emitter's update, so can be used without synchronisation
+        /// while generating emissions.
+        ///
+        /// @author agent
+        ///
+        /// @return The random number generator.
+        //----------------------------------------------------------------
+        FastRandom& GetRandom();
+        //----------------------------------------------------------------
         /// Generates the position and direction of a new emission. These 
         /// values are in local space. This will be called as part of a 
         /// background task.
@@ -126,11 +167,33 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<u32> TryEmitBurst(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation);
         //----------------------------------------------------------------
-        /// Emits a new particle if the next particle in the list is free
-        /// to be emitted. 
+        /// Rolls the emission chance for each of the given number of
+        /// emission attempts.
         ///
-        /// @author Ian Copland
+        /// @author agent
+        ///
+        /// @param The number of emission attempts.
+        /// @param The normalised playback time of emission.
+        ///
+        /// @return The number of attempts which should emit a particle.
+        //----------------------------------------------------------------
+        u32 CalcNumToEmit(u32 in_numAttempts, f32 in_normalisedEmissionTime);
+        //----------------------------------------------------------------
+        /// Emits the given number of particles, or as many as there is
+        /// space for in the particle array. The particle array always
+        /// keeps free space at the end of the active particles, so
+        /// acquiring particles is constant time. Any emissions that do not
+        /// fit are dropped and counted. Emission is also limited by the
+        /// level of detail particle limit and throttled by the global
+        /// particle budget.
+        ///
+        /// The initial particle properties are generated for the whole
+        /// batch at once, rather than once per particle, to reduce the
+        /// per-particle overhead of large bursts.
+        ///
+        /// @author agent
         /// 
+        /// @param The number of particles to emit.
         /// @param The normalised playback time of emission.
         /// @param The world space position of the emitter at the time
         /// of emission.
@@ -139,21 +202,22 @@ namespace ChilliSource
         /// @param The world orientation of the emitter at the time of
         /// emission.
         /// @param [In/Out] The list of emitted particles, will add to the
-        /// list if a particle is successfully emitted.
-        ///
-        /// @param The index of the emitted particle. 
+        /// list for each particle successfully emitted.
         //----------------------------------------------------------------
-        void Emit(f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
+        void EmitBatch(u32 in_numParticles, f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
 
         const ParticleEmitterDef* m_emitterDef = nullptr;
-        dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleArray* m_particleArray = nullptr;
 
         Vector3 m_emissionPosition;
         Vector3 m_emissionScale;
         Quaternion m_emissionOrientation;
         f32 m_emissionTime = 0.0f;
         bool m_hasEmitted = false;
-        u32 m_nextParticleIndex = 0;
+        f32 m_emissionRateScale = 1.0f;
+        u32 m_particleLimit = 0;
+        FastRandom m_random;
+        std::atomic<u32> m_numDroppedEmissions;
     };
 }
 
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/PointParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/PointParticleEmitterDef.h>
 
@@ -36,7 +36,7 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
+    PointParticleEmitter::PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray)
         : ParticleEmitter(in_particleEmitter, in_particleArray)
     {
     }
@@ -45,6 +45,6 @@ namespace ChilliSource
     void PointParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
         out_position = Vector3::k_zero;
-        out_direction = Random::GenerateDirection3D<f32>();
+        out_direction = GetRandom().GenerateDirection3D<f32>();
     }
 }
\ No newline at end of file
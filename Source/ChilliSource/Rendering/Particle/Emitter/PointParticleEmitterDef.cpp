@@ -59,7 +59,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ParticleEmitterUPtr PointParticleEmitterDef::CreateInstance(dynamic_array<Particle>* in_particleArray) const
+    ParticleEmitterUPtr PointParticleEmitterDef::CreateInstance(ParticleArray* in_particleArray) const
     {
         return ParticleEmitterUPtr(new PointParticleEmitter(this, in_particleArray));
     }
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitterDef.h>
 
@@ -41,18 +41,20 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param [In/Out] The random number generator.
+        ///
         /// @return A random point in a unit sphere.
         //----------------------------------------------------------------
-        Vector3 GeneratePointInUnitSphere()
+        Vector3 GeneratePointInUnitSphere(FastRandom& inout_random)
         {
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), (1.0f / 3.0f));
-            return Random::GenerateDirection3D<f32>() * dist;
+            f32 dist = std::pow(inout_random.GenerateNormalised<f32>(), (1.0f / 3.0f));
+            return inout_random.GenerateDirection3D<f32>() * dist;
         }
     }
 
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray)
+    SphereParticleEmitter::SphereParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray)
         : ParticleEmitter(in_particleEmitter, in_particleArray)
     {
         //Only the sphere emitter def can create this, so this is safe.
@@ -62,16 +64,16 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void SphereParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_sphereParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
+        f32 radius = m_sphereParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime, GetRandom());
 
         //calculate the position.
         switch (m_sphereParticleEmitterDef->GetEmitFromType())
         {
         case SphereParticleEmitterDef::EmitFromType::k_inside:
-            out_position = GeneratePointInUnitSphere() * radius;
+            out_position = GeneratePointInUnitSphere(GetRandom()) * radius;
             break;
         case SphereParticleEmitterDef::EmitFromType::k_surface:
-            out_position = Random::GenerateDirection3D<f32>() * radius;
+            out_position = GetRandom().GenerateDirection3D<f32>() * radius;
             break;
         default:
             CS_LOG_FATAL("Invalid 'Emit From' type.");
@@ -82,7 +84,7 @@ namespace ChilliSource
         switch (m_sphereParticleEmitterDef->GetEmitDirectionType())
         {
         case SphereParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Random::GenerateDirection3D<f32>();
+            out_direction = GetRandom().GenerateDirection3D<f32>();
             break;
         case SphereParticleEmitterDef::EmitDirectionType::k_awayFromCentre:
             out_direction = Vector3::Normalise(out_position);
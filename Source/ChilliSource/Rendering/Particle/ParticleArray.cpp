@@ -0,0 +1,307 @@
+//
+//  ParticleArray.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace ChilliSource
+{
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleArray::ParticleArray(u32 in_capacity, ParticleMemoryManager* in_memoryManager)
+        : m_memoryManager(in_memoryManager), m_slotIndices(in_memoryManager->AllocateArray<u32>(in_capacity)), m_slotGenerations(in_memoryManager->AllocateArray<u32>(in_capacity)),
+        m_activeFlags(in_memoryManager->AllocateArray<bool>(in_capacity)), m_lifetimes(in_memoryManager->AllocateArray<f32>(in_capacity)), m_energies(in_memoryManager->AllocateArray<f32>(in_capacity)),
+        m_positions(in_memoryManager->AllocateArray<Vector3>(in_capacity)), m_previousPositions(in_memoryManager->AllocateArray<Vector3>(in_capacity)),
+        m_scales(in_memoryManager->AllocateArray<Vector2>(in_capacity)), m_rotations(in_memoryManager->AllocateArray<f32>(in_capacity)),
+        m_colours(in_memoryManager->AllocateArray<Colour>(in_capacity)), m_velocities(in_memoryManager->AllocateArray<Vector3>(in_capacity)), m_angularVelocities(in_memoryManager->AllocateArray<f32>(in_capacity))
+    {
+        CS_ASSERT(m_memoryManager != nullptr, "Cannot create a particle array with a null memory manager.");
+
+        for (u32 i = 0; i < in_capacity; ++i)
+        {
+            m_slotIndices[i] = i;
+        }
+
+        m_slotGenerations.fill(0);
+        m_activeFlags.fill(false);
+        m_lifetimes.fill(0.0f);
+        m_energies.fill(0.0f);
+        m_positions.fill(Vector3::k_zero);
+        m_previousPositions.fill(Vector3::k_zero);
+        m_scales.fill(Vector2::k_one);
+        m_rotations.fill(0.0f);
+        m_colours.fill(Colour::k_white);
+        m_velocities.fill(Vector3::k_zero);
+        m_angularVelocities.fill(0.0f);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleMemoryManager* ParticleArray::GetMemoryManager() const
+    {
+        return m_memoryManager;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleArray::GetCapacity() const
+    {
+        return static_cast<u32>(m_activeFlags.size());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleArray::GetNumActiveParticles() const
+    {
+        return m_numActiveParticles;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleArray::ReserveParticles(u32 in_numParticles, ParticleEffect::Priority in_priority)
+    {
+        u32 numReserved = m_memoryManager->ReserveParticles(in_numParticles, in_priority);
+        m_numReservedParticles += numReserved;
+        return numReserved;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleArray::ReleaseUnusedParticles()
+    {
+        if (m_numReservedParticles > m_numActiveParticles)
+        {
+            m_memoryManager->ReleaseParticles(m_numReservedParticles - m_numActiveParticles);
+            m_numReservedParticles = m_numActiveParticles;
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleArray::AddParticle()
+    {
+        CS_ASSERT(m_numActiveParticles < GetCapacity(), "Cannot add a particle to a full particle array.");
+        CS_ASSERT(m_numActiveParticles < m_numReservedParticles, "Cannot add a particle which hasn't been reserved.");
+
+        u32 index = m_numActiveParticles++;
+        m_activeFlags[index] = true;
+
+        u32& generation = m_slotGenerations[m_slotIndices[index]];
+        if (++generation == 0)
+        {
+            generation = 1;
+        }
+
+        return index;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleArray::RemoveParticle(u32 in_index)
+    {
+        CS_ASSERT(in_index < m_numActiveParticles, "Cannot remove a particle that isn't active.");
+
+        u32 lastIndex = --m_numActiveParticles;
+        if (in_index != lastIndex)
+        {
+            m_lifetimes[in_index] = m_lifetimes[lastIndex];
+            m_energies[in_index] = m_energies[lastIndex];
+            m_positions[in_index] = m_positions[lastIndex];
+            m_previousPositions[in_index] = m_previousPositions[lastIndex];
+            m_scales[in_index] = m_scales[lastIndex];
+            m_rotations[in_index] = m_rotations[lastIndex];
+            m_colours[in_index] = m_colours[lastIndex];
+            m_velocities[in_index] = m_velocities[lastIndex];
+            m_angularVelocities[in_index] = m_angularVelocities[lastIndex];
+            m_activeFlags[in_index] = m_activeFlags[lastIndex];
+
+            //the slot indices are swapped rather than copied so the free slot ends up beyond the active particles.
+            std::swap(m_slotIndices[in_index], m_slotIndices[lastIndex]);
+        }
+
+        m_activeFlags[lastIndex] = false;
+        m_energies[lastIndex] = 0.0f;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleArray::Clear()
+    {
+        for (u32 i = 0; i < m_numActiveParticles; ++i)
+        {
+            m_activeFlags[i] = false;
+            m_energies[i] = 0.0f;
+        }
+
+        m_numActiveParticles = 0;
+        ReleaseUnusedParticles();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<u32>& ParticleArray::GetSlotIndices() const
+    {
+        return m_slotIndices;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<u32>& ParticleArray::GetSlotGenerations() const
+    {
+        return m_slotGenerations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<bool>& ParticleArray::GetActiveFlags()
+    {
+        return m_activeFlags;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<bool>& ParticleArray::GetActiveFlags() const
+    {
+        return m_activeFlags;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<f32>& ParticleArray::GetLifetimes()
+    {
+        return m_lifetimes;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<f32>& ParticleArray::GetLifetimes() const
+    {
+        return m_lifetimes;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<f32>& ParticleArray::GetEnergies()
+    {
+        return m_energies;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<f32>& ParticleArray::GetEnergies() const
+    {
+        return m_energies;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<Vector3>& ParticleArray::GetPositions()
+    {
+        return m_positions;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<Vector3>& ParticleArray::GetPositions() const
+    {
+        return m_positions;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<Vector3>& ParticleArray::GetPreviousPositions()
+    {
+        return m_previousPositions;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<Vector3>& ParticleArray::GetPreviousPositions() const
+    {
+        return m_previousPositions;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleArray::StorePreviousPositions(u32 in_start, u32 in_end)
+    {
+        CS_ASSERT(in_start <= in_end && in_end <= m_numActiveParticles, "Cannot store the previous positions of inactive particles.");
+
+        std::copy(m_positions.data() + in_start, m_positions.data() + in_end, m_previousPositions.data() + in_start);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<Vector2>& ParticleArray::GetScales()
+    {
+        return m_scales;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<Vector2>& ParticleArray::GetScales() const
+    {
+        return m_scales;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<f32>& ParticleArray::GetRotations()
+    {
+        return m_rotations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<f32>& ParticleArray::GetRotations() const
+    {
+        return m_rotations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<Colour>& ParticleArray::GetColours()
+    {
+        return m_colours;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<Colour>& ParticleArray::GetColours() const
+    {
+        return m_colours;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<Vector3>& ParticleArray::GetVelocities()
+    {
+        return m_velocities;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<Vector3>& ParticleArray::GetVelocities() const
+    {
+        return m_velocities;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    dynamic_array<f32>& ParticleArray::GetAngularVelocities()
+    {
+        return m_angularVelocities;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const dynamic_array<f32>& ParticleArray::GetAngularVelocities() const
+    {
+        return m_angularVelocities;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleArray::~ParticleArray()
+    {
+        m_numActiveParticles = 0;
+        ReleaseUnusedParticles();
+    }
+}
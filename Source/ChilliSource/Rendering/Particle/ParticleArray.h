@@ -0,0 +1,328 @@
+//
+//  ParticleArray.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEARRAY_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEARRAY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A container for the simulation state of all particles in a particle
+    /// effect. Rather than storing an array of particle structs, each
+    /// particle property is stored in its own contiguous array, indexed by
+    /// particle index. This allows the particle update, the affectors and
+    /// the emitter to only touch the properties they actually need.
+    ///
+    /// Active particles are kept densely packed at the start of the array,
+    /// so only the first GetNumActiveParticles() entries need processing.
+    /// When a particle is removed the last active particle is moved into 
+    /// its place. As particle indices are therefore not stable, each 
+    /// particle also has a slot index which remains constant while it is
+    /// active and can be used to key per-particle data outside of the
+    /// simulation.
+    ///
+    /// All storage is allocated from the given particle memory manager and
+    /// particles must be reserved from its global particle budget before
+    /// they are added. Reserved particles which are no longer active are
+    /// returned to the budget by ReleaseUnusedParticles().
+    ///
+    /// The particle array is updated as part of a background task and
+    /// should not be accessed from other threads while an update is in
+    /// progress.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleArray final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleArray);
+        //----------------------------------------------------------------
+        /// Constructor. All particles are initially inactive.
+        ///
+        /// @author agent
+        ///
+        /// @param The maximum number of particles in the array.
+        /// @param The memory manager which storage is allocated from and
+        /// particles are reserved from. This must outlive the array.
+        //----------------------------------------------------------------
+        ParticleArray(u32 in_capacity, ParticleMemoryManager* in_memoryManager);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The memory manager used by the array.
+        //----------------------------------------------------------------
+        ParticleMemoryManager* GetMemoryManager() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The maximum number of particles in the array.
+        //----------------------------------------------------------------
+        u32 GetCapacity() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of active particles. Active particles always
+        /// occupy the indices from zero to this value.
+        //----------------------------------------------------------------
+        u32 GetNumActiveParticles() const;
+        //----------------------------------------------------------------
+        /// Tries to reserve the given number of particles from the global
+        /// particle budget so that they can be added to the array.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of particles to reserve.
+        /// @param The priority of the effect.
+        ///
+        /// @return The number of particles reserved.
+        //----------------------------------------------------------------
+        u32 ReserveParticles(u32 in_numParticles, ParticleEffect::Priority in_priority);
+        //----------------------------------------------------------------
+        /// Returns any reserved particles which are no longer active to
+        /// the global particle budget.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void ReleaseUnusedParticles();
+        //----------------------------------------------------------------
+        /// Activates a new particle at the end of the active particles.
+        /// This is constant time, and the new particle takes the first
+        /// free slot index. The array must not be full and the particle
+        /// must have been reserved. The properties of the new particle
+        /// are left as they were, and should be set by the caller.
+        ///
+        /// @author agent
+        ///
+        /// @return The index of the new particle.
+        //----------------------------------------------------------------
+        u32 AddParticle();
+        //----------------------------------------------------------------
+        /// Removes the particle at the given index. The last active
+        /// particle is moved into the removed particles place so the
+        /// active particles remain densely packed. Any external data that
+        /// is indexed by particle index should be moved accordingly.
+        ///
+        /// @author agent
+        ///
+        /// @param The index of the particle to remove.
+        //----------------------------------------------------------------
+        void RemoveParticle(u32 in_index);
+        //----------------------------------------------------------------
+        /// Deactivates all particles, returning them to the global particle
+        /// budget.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void Clear();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The slot index of each particle. Slot indices are unique
+        /// among active particles and do not change while a particle is
+        /// active, regardless of where it is moved to in the array.
+        //----------------------------------------------------------------
+        const dynamic_array<u32>& GetSlotIndices() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The generation of each slot, indexed by slot index. A
+        /// slot's generation is incremented each time a particle is added
+        /// to it, allowing consumers to detect that a slot has been reused
+        /// even if they did not observe the previous particle being
+        /// removed. Generation zero is never used by an added particle.
+        //----------------------------------------------------------------
+        const dynamic_array<u32>& GetSlotGenerations() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return Whether or not each particle is active.
+        //----------------------------------------------------------------
+        dynamic_array<bool>& GetActiveFlags();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return Whether or not each particle is active.
+        //----------------------------------------------------------------
+        const dynamic_array<bool>& GetActiveFlags() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total lifetime of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<f32>& GetLifetimes();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total lifetime of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<f32>& GetLifetimes() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The remaining energy of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<f32>& GetEnergies();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The remaining energy of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<f32>& GetEnergies() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The position of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<Vector3>& GetPositions();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The position of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<Vector3>& GetPositions() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The position of each particle prior to the final step
+        /// of the last fixed time step update. Newly emitted particles
+        /// have the same previous position as their position.
+        //----------------------------------------------------------------
+        dynamic_array<Vector3>& GetPreviousPositions();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The position of each particle prior to the final step
+        /// of the last fixed time step update. Newly emitted particles
+        /// have the same previous position as their position.
+        //----------------------------------------------------------------
+        const dynamic_array<Vector3>& GetPreviousPositions() const;
+        //----------------------------------------------------------------
+        /// Copies the current position of each particle in the given
+        /// range to its previous position.
+        ///
+        /// @author agent
+        ///
+        /// @param The index of the first particle.
+        /// @param The index after the last particle.
+        //----------------------------------------------------------------
+        void StorePreviousPositions(u32 in_start, u32 in_end);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The scale of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<Vector2>& GetScales();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The scale of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<Vector2>& GetScales() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The rotation of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<f32>& GetRotations();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The rotation of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<f32>& GetRotations() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The colour of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<Colour>& GetColours();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The colour of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<Colour>& GetColours() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The velocity of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<Vector3>& GetVelocities();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The velocity of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<Vector3>& GetVelocities() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The angular velocity of each particle.
+        //----------------------------------------------------------------
+        dynamic_array<f32>& GetAngularVelocities();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The angular velocity of each particle.
+        //----------------------------------------------------------------
+        const dynamic_array<f32>& GetAngularVelocities() const;
+        //----------------------------------------------------------------
+        /// Destructor. Returns all reserved particles to the global
+        /// particle budget.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ~ParticleArray();
+        
+    private:
+        ParticleMemoryManager* m_memoryManager = nullptr;
+        u32 m_numActiveParticles = 0;
+        u32 m_numReservedParticles = 0;
+        dynamic_array<u32> m_slotIndices;
+        dynamic_array<u32> m_slotGenerations;
+        dynamic_array<bool> m_activeFlags;
+        dynamic_array<f32> m_lifetimes;
+        dynamic_array<f32> m_energies;
+        dynamic_array<Vector3> m_positions;
+        dynamic_array<Vector3> m_previousPositions;
+        dynamic_array<Vector2> m_scales;
+        dynamic_array<f32> m_rotations;
+        dynamic_array<Colour> m_colours;
+        dynamic_array<Vector3> m_velocities;
+        dynamic_array<f32> m_angularVelocities;
+    };
+}
+
+#endif
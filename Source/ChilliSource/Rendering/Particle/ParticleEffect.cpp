@@ -28,6 +28,8 @@
 
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(ParticleEffect);
@@ -56,6 +58,12 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    f32 ParticleEffect::GetPrewarmDuration() const
+    {
+        return m_prewarmDuration;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     u32 ParticleEffect::GetMaxParticles() const
     {
         return m_maxParticles;
@@ -68,6 +76,24 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    ParticleEffect::Priority ParticleEffect::GetPriority() const
+    {
+        return m_priority;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    bool ParticleEffect::UsesPredictedBounds() const
+    {
+        return (m_hasPredictedBounds == true && m_simulationSpace == SimulationSpace::k_local);
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    f32 ParticleEffect::GetPredictedBoundsExtent() const
+    {
+        return m_predictedBoundsExtent;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     const ParticleProperty<f32>* ParticleEffect::GetLifetimeProperty() const
     {
         return m_lifetimeProperty.get();
@@ -129,12 +155,51 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    ParticleEffect::LodMetric ParticleEffect::GetLodMetric() const
+    {
+        return m_lodMetric;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    const std::vector<ParticleEffect::LodBand>& ParticleEffect::GetLodBands() const
+    {
+        return m_lodBands;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    const ParticleEffect::LodBand* ParticleEffect::SelectLodBand(f32 in_metricValue) const
+    {
+        const LodBand* output = nullptr;
+
+        for (const auto& lodBand : m_lodBands)
+        {
+            const bool applies = (m_lodMetric == LodMetric::k_distance) ? (in_metricValue >= lodBand.m_threshold) : (in_metricValue <= lodBand.m_threshold);
+            if (applies == false)
+            {
+                break;
+            }
+
+            output = &lodBand;
+        }
+
+        return output;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void ParticleEffect::SetDuration(f32 in_duration)
     {
         m_duration = in_duration;
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void ParticleEffect::SetPrewarmDuration(f32 in_prewarmDuration)
+    {
+        CS_ASSERT(in_prewarmDuration >= 0.0f, "Prewarm duration cannot be negative.");
+
+        m_prewarmDuration = in_prewarmDuration;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void ParticleEffect::SetMaxParticles(u32 in_maxParticles)
     {
         m_maxParticles = in_maxParticles;
@@ -147,6 +212,21 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void ParticleEffect::SetPriority(Priority in_priority)
+    {
+        m_priority = in_priority;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void ParticleEffect::SetPredictedBounds(f32 in_emitterExtent, f32 in_maxSpeed, f32 in_maxLifetime)
+    {
+        CS_ASSERT(in_emitterExtent >= 0.0f && in_maxSpeed >= 0.0f && in_maxLifetime >= 0.0f, "Predicted particle bounds cannot be negative.");
+
+        m_hasPredictedBounds = true;
+        m_predictedBoundsExtent = in_emitterExtent + in_maxSpeed * in_maxLifetime;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void ParticleEffect::SetLifetimeProperty(ParticlePropertyUPtr<f32> in_lifetimeProperty)
     {
         m_lifetimeProperty = std::move(in_lifetimeProperty);
@@ -213,6 +293,26 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void ParticleEffect::SetLodBands(LodMetric in_lodMetric, std::vector<LodBand> in_lodBands)
+    {
+        m_lodMetric = in_lodMetric;
+        m_lodBands = std::move(in_lodBands);
+
+        std::sort(m_lodBands.begin(), m_lodBands.end(), [=](const LodBand& in_lhs, const LodBand& in_rhs)
+        {
+            return (m_lodMetric == LodMetric::k_distance) ? (in_lhs.m_threshold < in_rhs.m_threshold) : (in_lhs.m_threshold > in_rhs.m_threshold);
+        });
+
+#ifdef CS_ENABLE_DEBUG
+        for (const auto& lodBand : m_lodBands)
+        {
+            CS_ASSERT(lodBand.m_emissionRateScale >= 0.0f && lodBand.m_maxParticlesScale >= 0.0f, "Particle lod scales cannot be negative.");
+            CS_ASSERT(lodBand.m_updateInterval > 0, "Particle lod update interval must be at least 1.");
+        }
+#endif
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     ParticleEffect::~ParticleEffect()
     {
         m_lifetimeProperty.reset();
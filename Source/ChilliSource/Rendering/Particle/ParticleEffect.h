@@ -72,6 +72,49 @@ namespace ChilliSource
             k_world
         };
         //----------------------------------------------------------------
+        /// The priority of the particle effect. This determines how much
+        /// of the global particle budget instances of the effect can
+        /// emit into: high priority effects can use the whole budget,
+        /// while normal and low priority effects are throttled once it is
+        /// 90% and 75% full respectively.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        enum class Priority
+        {
+            k_low,
+            k_normal,
+            k_high
+        };
+        //----------------------------------------------------------------
+        /// The metric used to select the level of detail band for an
+        /// instance of the effect.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        enum class LodMetric
+        {
+            k_distance,
+            k_projectedSize
+        };
+        //----------------------------------------------------------------
+        /// A level of detail band. When the distance metric is used, the
+        /// band applies to instances at least the threshold distance from
+        /// the camera. When the projected size metric is used, it applies
+        /// to instances whose bounding sphere has a projected radius no
+        /// greater than the threshold, as a fraction of half the screen
+        /// height.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct LodBand final
+        {
+            f32 m_threshold = 0.0f;
+            f32 m_emissionRateScale = 1.0f;
+            f32 m_maxParticlesScale = 1.0f;
+            u32 m_updateInterval = 1;
+        };
+        //----------------------------------------------------------------
         /// Allows querying of whether or not this implements the interface
         /// described by the given Id.
         ///
@@ -89,6 +132,14 @@ namespace ChilliSource
         //----------------------------------------------------------------
         f32 GetDuration() const;
         //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The amount of time a looping particle effect is
+        /// simulated for when it starts playing, so that it begins in its
+        /// steady state rather than visibly filling up.
+        //----------------------------------------------------------------
+        f32 GetPrewarmDuration() const;
+        //----------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @return The max number of particles in the effect.
@@ -101,6 +152,32 @@ namespace ChilliSource
         //----------------------------------------------------------------
         SimulationSpace GetSimulationSpace() const;
         //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The priority of the particle effect when emitting
+        /// into the global particle budget.
+        //----------------------------------------------------------------
+        Priority GetPriority() const;
+        //----------------------------------------------------------------
+        /// Predicted bounds are only used if they have been set and the
+        /// effect is simulated in local space. In world space, particles
+        /// emitted earlier trail behind a moving entity, so the bounds
+        /// cannot be predicted from the emitter alone.
+        ///
+        /// @author agent
+        ///
+        /// @return Whether or not the bounds of the effect are predicted,
+        /// rather than calculated from the particle positions.
+        //----------------------------------------------------------------
+        bool UsesPredictedBounds() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The half extent, in local space, of the predicted
+        /// bounds of the effect.
+        //----------------------------------------------------------------
+        f32 GetPredictedBoundsExtent() const;
+        //----------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @return The property used to generate the lifetime of a new 
@@ -162,6 +239,32 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<const ParticleAffectorDef*> GetAffectorDefs() const;
         //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The metric used to select the level of detail band.
+        //----------------------------------------------------------------
+        LodMetric GetLodMetric() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The level of detail bands, ordered from the most to
+        /// the least detailed. This will be empty if the effect should
+        /// always be played at full detail.
+        //----------------------------------------------------------------
+        const std::vector<LodBand>& GetLodBands() const;
+        //----------------------------------------------------------------
+        /// Selects the level of detail band for the given metric value.
+        ///
+        /// @author agent
+        ///
+        /// @param The distance to the camera or the projected size,
+        /// depending on the lod metric.
+        ///
+        /// @return The selected band, or null if the effect should be
+        /// played at full detail.
+        //----------------------------------------------------------------
+        const LodBand* SelectLodBand(f32 in_metricValue) const;
+        //----------------------------------------------------------------
         /// Sets the duration of the particle effect. 
         ///
         /// @author Ian Copland
@@ -170,6 +273,17 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetDuration(f32 in_duration);
         //----------------------------------------------------------------
+        /// Sets the amount of time a looping particle effect is simulated
+        /// for when it starts playing. The simulation is performed in a
+        /// single background update using coarse time steps. A duration of
+        /// zero disables prewarming.
+        ///
+        /// @author agent
+        ///
+        /// @param The prewarm duration.
+        //----------------------------------------------------------------
+        void SetPrewarmDuration(f32 in_prewarmDuration);
+        //----------------------------------------------------------------
         /// Sets the maximum number of particles in the effect.
         ///
         /// @author Ian Copland
@@ -186,6 +300,32 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetSimulationSpace(SimulationSpace in_simulationSpace);
         //----------------------------------------------------------------
+        /// Sets the priority of the particle effect when emitting into the
+        /// global particle budget.
+        ///
+        /// @author agent
+        ///
+        /// @param The priority.
+        //----------------------------------------------------------------
+        void SetPriority(Priority in_priority);
+        //----------------------------------------------------------------
+        /// Sets conservative predicted bounds for the effect. The bounds
+        /// are a box centred on the emitter which contains the furthest
+        /// any particle can travel: the extent of the emitter shape plus
+        /// the max speed multiplied by the max lifetime. Using predicted
+        /// bounds avoids calculating the bounds from the particles each
+        /// update. The max speed should account for any acceleration
+        /// applied by affectors.
+        ///
+        /// @author agent
+        ///
+        /// @param The max distance from the emitter origin a particle can
+        /// be emitted.
+        /// @param The max speed of a particle.
+        /// @param The max lifetime of a particle.
+        //----------------------------------------------------------------
+        void SetPredictedBounds(f32 in_emitterExtent, f32 in_maxSpeed, f32 in_maxLifetime);
+        //----------------------------------------------------------------
         /// Sets the property used to generate the lifetime of a new 
         /// particle.
         ///
@@ -265,6 +405,16 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetAffectorDefs(std::vector<ParticleAffectorDefUPtr> in_affectorDefs);
         //----------------------------------------------------------------
+        /// Sets the level of detail bands for the particle effect. The
+        /// bands do not need to be in order.
+        ///
+        /// @author agent
+        ///
+        /// @param The metric used to select a band.
+        /// @param The level of detail bands.
+        //----------------------------------------------------------------
+        void SetLodBands(LodMetric in_lodMetric, std::vector<LodBand> in_lodBands);
+        //----------------------------------------------------------------
         /// Destructor
         ///
         /// @author Ian Copland
@@ -287,8 +437,12 @@ namespace ChilliSource
         ParticleEffect();
 
         f32 m_duration = 1.0f;
+        f32 m_prewarmDuration = 0.0f;
         u32 m_maxParticles = 100;
         SimulationSpace m_simulationSpace = SimulationSpace::k_local;
+        Priority m_priority = Priority::k_normal;
+        bool m_hasPredictedBounds = false;
+        f32 m_predictedBoundsExtent = 0.0f;
 
         ParticlePropertyUPtr<f32> m_lifetimeProperty;
         ParticlePropertyUPtr<Vector2> m_initialScaleProperty = ParticlePropertyUPtr<Vector2>(new ConstantParticleProperty<Vector2>(Vector2::k_one));
@@ -300,6 +454,9 @@ namespace ChilliSource
         ParticleDrawableDefUPtr m_drawableDef;
         ParticleEmitterDefUPtr m_emitterDef;
         std::vector<ParticleAffectorDefUPtr> m_affectorDefs;
+
+        LodMetric m_lodMetric = LodMetric::k_distance;
+        std::vector<LodBand> m_lodBands;
     };
 }
 
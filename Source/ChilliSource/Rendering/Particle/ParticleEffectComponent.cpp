@@ -32,12 +32,16 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
+#include <ChilliSource/Rendering/Particle/ParticleStats.h>
+#include <ChilliSource/Rendering/Particle/ParticleSystem.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
@@ -45,33 +49,15 @@
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
-#include <limits>
+#include <cmath>
 #include <tuple>
 
 namespace ChilliSource
 {
     namespace
     {
-        //----------------------------------------------------------------
-        /// A container for all information required by the background
-        /// particle update.
-        ///
-        /// @author Ian Copland
-        //----------------------------------------------------------------
-        struct ParticleUpdateDesc final
-        {
-            ParticleEffectCSPtr m_particleEffect;
-            ParticleEmitterSPtr m_particleEmitter;
-            std::vector<ParticleAffectorSPtr> m_particleAffectors;
-            std::shared_ptr<dynamic_array<Particle>> m_particleArray;
-            ConcurrentParticleDataSPtr m_concurrentParticleData;
-            f32 m_playbackTime = 0.0f;
-            f32 m_deltaTime = 0.0f; 
-            Vector3 m_entityPosition;
-            Vector3 m_entityScale;
-            Quaternion m_entityOrientation;
-            bool m_interpolateEmission = false;
-        };
+        const f32 k_maxCatchUpDuration = 5.0f;
+
         //----------------------------------------------------------------
         /// Performs a series of assertions to ensure the given particle 
         /// effect is ready for use.
@@ -92,124 +78,70 @@ namespace ChilliSource
             CS_ASSERT(in_particleEffect->GetInitialAngularVelocityProperty() != nullptr, "Trying to use incomplete particle effect: Initial angular velocity property missing.");
         }
         //----------------------------------------------------------------
-        /// Calculates the bounding shapes for the given set of particles.
+        /// Expands the given bounding shapes to include the given point.
+        /// If the bounds are empty they will instead be placed at the
+        /// point.
         ///
-        /// @author Ian Copland
+        /// @author agent
         ///
-        /// @param The particle effect.
-        /// @param The array of particles.
-        /// 
-        /// @return a pair containing the AABB and the Bounding Sphere.
+        /// @param The point.
+        /// @param [In/Out] The AABB.
+        /// @param [In/Out] The bounding sphere.
         //----------------------------------------------------------------
-        std::pair<AABB, Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const dynamic_array<Particle>* in_particleArray)
+        void ExpandBoundingShapes(const Vector3& in_point, AABB& inout_aabb, Sphere& inout_boundingSphere)
         {
-            Vector3 min = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-            Vector3 max = Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-
-            bool anyActive = false;
-            for (const auto& particle : *in_particleArray)
+            if (inout_aabb.GetSize() == Vector3::k_zero)
             {
-                if (particle.m_isActive == true)
-                {
-                    anyActive = true;
-
-                    if (particle.m_position.x < min.x)
-                        min.x = particle.m_position.x;
-                    if (particle.m_position.y < min.y)
-                        min.y = particle.m_position.y;
-                    if (particle.m_position.z < min.z)
-                        min.z = particle.m_position.z;
-
-                    if (particle.m_position.x > max.x)
-                        max.x = particle.m_position.x;
-                    if (particle.m_position.y > max.y)
-                        max.y = particle.m_position.y;
-                    if (particle.m_position.z > max.z)
-                        max.z = particle.m_position.z;
-                }
+                inout_aabb = AABB(in_point, Vector3::k_zero);
+                inout_boundingSphere = Sphere(in_point, 0.0f);
+                return;
             }
 
-            if (anyActive == false)
-            {
-                min = Vector3::k_zero;
-                max = Vector3::k_zero;
-            }
+            Vector3 min = Vector3::Min(inout_aabb.GetOrigin() - inout_aabb.GetHalfSize(), in_point);
+            Vector3 max = Vector3::Max(inout_aabb.GetOrigin() + inout_aabb.GetHalfSize(), in_point);
 
             Vector3 size = max - min;
             Vector3 centre = min + 0.5f * size;
 
-            return std::make_pair(AABB(centre, size), Sphere(centre, size.Length() * 0.5f));
+            inout_aabb = AABB(centre, size);
+            inout_boundingSphere = Sphere(centre, size.Length() * 0.5f);
         }
         //----------------------------------------------------------------
-        /// Updates the particles on a background thread. This will emit
-        /// new particles, update existing particles and apply particle
-        /// affectors. These changes will then be committed to the 
-        /// draw data array to update the next render.
+        /// Calculates the AABB which contains the given AABB after it has
+        /// been transformed by the given affine transform. The centre is
+        /// transformed and the half size is projected onto each axis
+        /// using the absolute values of the transform's rotation and
+        /// scale. This gives the same result as transforming each of the
+        /// eight corners, without needing to store them.
         ///
-        /// @author Ian Copland
+        /// @author agent
+        ///
+        /// @param The AABB.
+        /// @param The affine transform.
         ///
-        /// @param in_desc - The particle update description. This contains
-        /// a snapshot of all data required to update the particle effect.
+        /// @return The transformed AABB.
         //----------------------------------------------------------------
-        void ParticleUpdateTask(const ParticleUpdateDesc& in_desc)
+        AABB TransformAABB(const AABB& in_aabb, const Matrix4& in_transform)
         {
-            CS_ASSERT(in_desc.m_particleEffect != nullptr, "Cannot update particles with null particle effect.");
-            CS_ASSERT(in_desc.m_particleArray != nullptr, "Cannot update particles with null particle array.");
-            CS_ASSERT(in_desc.m_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
-
-            //update the particles
-            for (auto& particle : *in_desc.m_particleArray)
-            {
-                if (particle.m_isActive == true)
-                {
-                    particle.m_energy -= in_desc.m_deltaTime;
-                    if (particle.m_energy > 0.0f)
-                    {
-                        particle.m_position += particle.m_velocity * in_desc.m_deltaTime;
-                        particle.m_rotation += particle.m_angularVelocity * in_desc.m_deltaTime;
-                    }
-                    else
-                    {
-                        particle.m_energy = 0.0f;
-                        particle.m_isActive = false;
-                    }
-                }
-            }
+            const Vector3 centre = in_aabb.GetOrigin() * in_transform;
+            const Vector3& halfSize = in_aabb.GetHalfSize();
 
-            //calculate the normalised playback progress.
-            const f32 effectProgress = in_desc.m_playbackTime / in_desc.m_particleEffect->GetDuration();
-            
-            //apply affectors
-            for (auto& affector : in_desc.m_particleAffectors)
-            {
-                affector->AffectParticles(in_desc.m_deltaTime, effectProgress);
-            }
+            Vector3 halfExtents;
+            halfExtents.x = std::abs(in_transform.m[0]) * halfSize.x + std::abs(in_transform.m[4]) * halfSize.y + std::abs(in_transform.m[8]) * halfSize.z;
+            halfExtents.y = std::abs(in_transform.m[1]) * halfSize.x + std::abs(in_transform.m[5]) * halfSize.y + std::abs(in_transform.m[9]) * halfSize.z;
+            halfExtents.z = std::abs(in_transform.m[2]) * halfSize.x + std::abs(in_transform.m[6]) * halfSize.y + std::abs(in_transform.m[10]) * halfSize.z;
 
-            //try to emit
-            std::vector<u32> newIndices;
-            if (in_desc.m_particleEmitter != nullptr)
-            {
-                newIndices = in_desc.m_particleEmitter->TryEmit(in_desc.m_playbackTime, in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation, in_desc.m_interpolateEmission);
-            }
-
-            //Initialise any new particles in each affector.
-            for (u32 newIndex : newIndices)
-            {
-                for (auto& affector : in_desc.m_particleAffectors)
-                {
-                    affector->ActivateParticle(newIndex, effectProgress);
-                }
-            }
-
-            auto boundingShapes = CalculateBoundingShapes(in_desc.m_particleEffect.get(), in_desc.m_particleArray.get());
-            in_desc.m_concurrentParticleData->CommitParticleData(in_desc.m_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
+            return AABB(centre, 2.0f * halfExtents);
         }
     }
     CS_DEFINE_NAMEDTYPE(ParticleEffectComponent);
     //-------------------------------------------------------
     //-------------------------------------------------------
     ParticleEffectComponent::ParticleEffectComponent(const ParticleEffectCSPtr& in_particleEffect)
+        : m_particleSystem(Application::Get()->GetSystem<ParticleSystem>())
     {
+        CS_ASSERT(m_particleSystem != nullptr, "Particle effect components require the particle system.");
+
         SetParticleEffect(in_particleEffect);
     }
     //-------------------------------------------------------
@@ -228,6 +160,14 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    ParticleSimulationCacheCSPtr ParticleEffectComponent::GetSimulationCache() const
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only get the Simulation Cache on the main thread.");
+
+        return m_simulationCache;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     ParticleEffectComponent::PlaybackType ParticleEffectComponent::GetPlaybackType() const
     {
         CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only get the playback type of a particle effect on the main thread.");
@@ -250,6 +190,19 @@ namespace ChilliSource
 
         return (m_playbackState == PlaybackState::k_starting || m_playbackState == PlaybackState::k_playing);
     }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 ParticleEffectComponent::GetNumDroppedEmissions() const
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Can only query the number of dropped emissions on the main thread.");
+
+        if (m_emitter == nullptr)
+        {
+            return 0;
+        }
+
+        return m_emitter->GetNumDroppedEmissions();
+    }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     const AABB& ParticleEffectComponent::GetAABB()
@@ -294,6 +247,16 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void ParticleEffectComponent::SetSimulationCache(const ParticleSimulationCacheCSPtr& in_simulationCache)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Simulation Cache must be set on the main thread.");
+        CS_ASSERT(in_simulationCache == nullptr || in_simulationCache->GetLoadState() == Resource::LoadState::k_loaded, "Simulation Cache must be loaded.");
+
+        m_simulationCache = in_simulationCache;
+        m_simulationCacheTimer = 0.0f;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void ParticleEffectComponent::SetPlaybackType(PlaybackType in_playbackType)
     {
         CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Play back type must be set on the main thread.");
@@ -318,8 +281,14 @@ namespace ChilliSource
         }
 
         m_playbackTimer = 0.0f;
+        m_simulationCacheTimer = 0.0f;
         m_accumulatedDeltaTime = 0.0f;
         m_firstFrame = true;
+        m_renderedSinceUpdate = false;
+        m_visible = true;
+        m_framesSinceUpdate = 0;
+        m_skippedTime = 0.0f;
+        m_numUnsimulatedFixedUpdates = 0;
 
         //reset the bounding shapes.
         m_localAABB = AABB();
@@ -377,8 +346,8 @@ namespace ChilliSource
         {
             ValidateParticleEffect(m_particleEffect);
 
-            m_particleArray = std::make_shared<dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
-            m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
+            m_particleArray = std::make_shared<ParticleArray>(m_particleEffect->GetMaxParticles(), m_particleSystem->GetMemoryManager());
+            m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles(), m_particleSystem->GetMemoryManager());
 
             m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
             CS_ASSERT(m_drawable != nullptr, "Failed to create particle drawable.");
@@ -419,6 +388,7 @@ namespace ChilliSource
     {
         CS_ASSERT((m_playbackState == PlaybackState::k_playing || m_playbackState == PlaybackState::k_stopping), "Can only store local bounding shapes when playing or stopping.");
 
+        m_concurrentParticleData->FetchCommittedData();
         m_localAABB = m_concurrentParticleData->GetAABB();
         m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
         m_invalidateBoundingShapeCache = true;
@@ -446,43 +416,10 @@ namespace ChilliSource
                 mOBBoundingBox = OOBB(m_localAABB.GetOrigin(), m_localAABB.GetSize());
                 mOBBoundingBox.SetTransform(worldMatrix);
 
-                //transform the 8 points of the AABB into world space and recalculate.
-                std::vector<Vector3> points;
-                points.push_back(m_localAABB.BackBottomLeft() * worldMatrix);
-                points.push_back(m_localAABB.BackBottomRight() * worldMatrix);
-                points.push_back(m_localAABB.BackTopLeft() * worldMatrix);
-                points.push_back(m_localAABB.BackTopRight() * worldMatrix);
-                points.push_back(m_localAABB.FrontBottomLeft() * worldMatrix);
-                points.push_back(m_localAABB.FrontBottomRight() * worldMatrix);
-                points.push_back(m_localAABB.FrontTopLeft() * worldMatrix);
-                points.push_back(m_localAABB.FrontTopRight() * worldMatrix);
-
-                Vector3 min = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-                Vector3 max = Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-                for (auto& point : points)
-                {
-                    if (point.x < min.x)
-                        min.x = point.x;
-                    if (point.y < min.y)
-                        min.y = point.y;
-                    if (point.z < min.z)
-                        min.z = point.z;
-
-                    if (point.x > max.x)
-                        max.x = point.x;
-                    if (point.y > max.y)
-                        max.y = point.y;
-                    if (point.z > max.z)
-                        max.z = point.z;
-                }
-
-                Vector3 size = max - min;
-                Vector3 centre = min + 0.5f * size;
-
-                mBoundingBox = AABB(centre, size);
+                mBoundingBox = TransformAABB(m_localAABB, worldMatrix);
 
                 //bounding sphere encapsulates the AABB.
-                mBoundingSphere = Sphere(centre, size.Length() * 0.5f);
+                mBoundingSphere = Sphere(mBoundingBox.GetOrigin(), mBoundingBox.GetSize().Length() * 0.5f);
             }
 
             m_invalidateBoundingShapeCache = false;
@@ -506,21 +443,60 @@ namespace ChilliSource
     //-------------------------------------------------------
     void ParticleEffectComponent::OnUpdate(f32 in_deltaTime)
     {
-        if (m_particleEffect != nullptr)
+        m_visible = m_renderedSinceUpdate;
+        m_renderedSinceUpdate = false;
+
+        if (m_particleEffect != nullptr && m_simulationCache != nullptr)
         {
+            UpdateSimulationCachePlayback(in_deltaTime);
+        }
+        else if (m_particleEffect != nullptr)
+        {
+            f32 deltaTime = in_deltaTime;
+
+            //in fixed time step mode only whole steps are simulated, the remaining fixed updates carrying over to later frames.
+            m_timeStep = m_particleSystem->GetFixedTimeStep();
+            if (m_timeStep > 0.0f)
+            {
+                const u32 numFixedUpdatesPerStep = m_particleSystem->GetNumFixedUpdatesPerStep();
+                const u32 numSteps = m_numUnsimulatedFixedUpdates / numFixedUpdatesPerStep;
+                m_numUnsimulatedFixedUpdates -= numSteps * numFixedUpdatesPerStep;
+                deltaTime = f32(numSteps) * m_timeStep;
+
+                //stopping effects still check whether their particles have finished each frame, so they stop on time.
+                if (numSteps == 0 && m_playbackState == PlaybackState::k_stopping)
+                {
+                    m_concurrentParticleData->FetchCommittedData();
+                    if (m_concurrentParticleData->HasActiveParticles() == false)
+                    {
+                        Stop();
+                    }
+                    return;
+                }
+
+                if (numSteps == 0 && m_playbackState == PlaybackState::k_playing)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                m_numUnsimulatedFixedUpdates = 0;
+            }
+
             switch (m_playbackState)
             {
             case PlaybackState::k_notPlaying:
                 //Do nothing.
                 break;
             case PlaybackState::k_starting:
-                UpdateStartingState(in_deltaTime);
+                UpdateStartingState(deltaTime);
                 break;
             case PlaybackState::k_playing:
-                UpdatePlayingState(in_deltaTime);
+                UpdatePlayingState(deltaTime);
                 break;
             case PlaybackState::k_stopping:
-                UpdateStoppingState(in_deltaTime);
+                UpdateStoppingState(deltaTime);
                 break;
             default:
                 CS_LOG_FATAL("Invalid playback state.");
@@ -530,16 +506,31 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
+    void ParticleEffectComponent::OnFixedUpdate(f32 in_fixedDeltaTime)
+    {
+        //fixed updates are counted rather than their time accumulated, so rounding can never lose a step.
+        if (m_particleSystem->GetNumFixedUpdatesPerStep() > 0)
+        {
+            ++m_numUnsimulatedFixedUpdates;
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
     void ParticleEffectComponent::UpdateStartingState(f32 in_deltaTime)
     {
         if (m_concurrentParticleData->StartUpdate() == true)
         {
-            //intialise the particles by disabling them all.
-            for (auto& particle : *m_particleArray)
+            //intialise the particles by disabling them all and reset the emitter, as both may be reused from a previous playback.
+            m_particleArray->Clear();
+            m_emitter->Reset();
+            m_concurrentParticleData->CommitParticleData(m_particleArray.get(), AABB(), Sphere());
+
+            //the prewarm simulates from the start of the effect, so playback continues from where it finishes.
+            if (m_playbackType == PlaybackType::k_looping && m_particleEffect->GetPrewarmDuration() > 0.0f)
             {
-                particle.m_isActive = false;
+                m_pendingPrewarmDuration = m_particleEffect->GetPrewarmDuration();
+                m_playbackTimer += std::fmod(m_pendingPrewarmDuration, m_particleEffect->GetDuration());
             }
-            m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), AABB(), Sphere());
 
             m_playbackState = PlaybackState::k_playing;
             UpdatePlayingState(in_deltaTime);
@@ -548,6 +539,7 @@ namespace ChilliSource
         {
             m_playbackTimer += in_deltaTime;
             m_accumulatedDeltaTime += in_deltaTime;
+            m_particleSystem->GetStats()->AddSkippedUpdate();
         }
     }
     //----------------------------------------------------------------
@@ -572,68 +564,184 @@ namespace ChilliSource
         }
 
         m_accumulatedDeltaTime += in_deltaTime;
-        if (m_concurrentParticleData->StartUpdate() == true)
+
+        //effects which are out of view only advance the playback time. World space bounds are expanded to follow the
+        //entity so that the effect will still be considered for rendering if it moves into view.
+        if (m_visible == false && m_firstFrame == false)
+        {
+            m_skippedTime += m_accumulatedDeltaTime;
+            m_accumulatedDeltaTime = 0.0f;
+            m_framesSinceUpdate = 0;
+
+            if (m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world)
+            {
+                ExpandBoundingShapes(GetEntity()->GetTransform().GetWorldPosition(), m_localAABB, m_localBoundingSphere);
+                m_invalidateBoundingShapeCache = true;
+            }
+            return;
+        }
+
+        ++m_framesSinceUpdate;
+        if (m_firstFrame == false && m_framesSinceUpdate < m_lodUpdateInterval)
+        {
+            return;
+        }
+
+        if (TryStartUpdate() == true)
         {
             StoreLocalBoundingShapes();
 
-            ParticleUpdateDesc desc;
+            ParticleSystem::UpdateDesc desc;
             desc.m_particleEffect = m_particleEffect;
             desc.m_particleEmitter = m_emitter;
             desc.m_particleAffectors = m_affectors;
+            desc.m_vertexBuilder = m_drawable->GetVertexBuilder();
             desc.m_particleArray = m_particleArray;
             desc.m_concurrentParticleData = m_concurrentParticleData;
             desc.m_playbackTime = m_playbackTimer;
             desc.m_deltaTime = m_accumulatedDeltaTime;
+            desc.m_timeStep = m_timeStep;
             desc.m_entityPosition = GetEntity()->GetTransform().GetWorldPosition();
             desc.m_entityScale = GetEntity()->GetTransform().GetWorldScale();
             desc.m_entityOrientation = GetEntity()->GetTransform().GetWorldOrientation();
             desc.m_interpolateEmission = (m_firstFrame == false);
-            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext&) noexcept
-            {
-                ParticleUpdateTask(desc);
-            });
+            desc.m_looping = (m_playbackType == PlaybackType::k_looping);
+            desc.m_prewarmDuration = m_pendingPrewarmDuration + std::min(m_skippedTime, k_maxCatchUpDuration);
+            desc.m_emissionRateScale = m_lodEmissionRateScale;
+            desc.m_maxParticlesScale = m_lodMaxParticlesScale;
+            m_particleSystem->QueueUpdate(std::move(desc));
 
             m_firstFrame = false;
             m_accumulatedDeltaTime = 0.0f;
+            m_pendingPrewarmDuration = 0.0f;
+            m_framesSinceUpdate = 0;
+            m_skippedTime = 0.0f;
         }
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ParticleEffectComponent::UpdateStoppingState(f32 in_deltaTime)
     {
+        m_concurrentParticleData->FetchCommittedData();
         if (m_concurrentParticleData->HasActiveParticles() == false)
         {
             Stop();
         }
         else
         {
+            //stopping effects are always simulated, even when out of view, so that they will finish.
             m_accumulatedDeltaTime += in_deltaTime;
-            if (m_concurrentParticleData->StartUpdate() == true)
+
+            ++m_framesSinceUpdate;
+            if (m_firstFrame == false && m_framesSinceUpdate < m_lodUpdateInterval)
+            {
+                return;
+            }
+
+            if (TryStartUpdate() == true)
             {
                 StoreLocalBoundingShapes();
 
-                ParticleUpdateDesc desc;
+                ParticleSystem::UpdateDesc desc;
                 desc.m_particleEffect = m_particleEffect;
                 desc.m_particleEmitter = nullptr;
                 desc.m_particleAffectors = m_affectors;
+                desc.m_vertexBuilder = m_drawable->GetVertexBuilder();
                 desc.m_particleArray = m_particleArray;
                 desc.m_concurrentParticleData = m_concurrentParticleData;
                 desc.m_playbackTime = m_playbackTimer;
                 desc.m_deltaTime = m_accumulatedDeltaTime;
+                desc.m_timeStep = m_timeStep;
                 desc.m_entityPosition = GetEntity()->GetTransform().GetWorldPosition();
                 desc.m_entityScale = GetEntity()->GetTransform().GetWorldScale();
                 desc.m_entityOrientation = GetEntity()->GetTransform().GetWorldOrientation();
                 desc.m_interpolateEmission = (m_firstFrame == false);
-                Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext&) noexcept
-                {
-                    ParticleUpdateTask(desc);
-                });
+                desc.m_looping = (m_playbackType == PlaybackType::k_looping);
+                desc.m_prewarmDuration = std::min(m_skippedTime, k_maxCatchUpDuration);
+                m_particleSystem->QueueUpdate(std::move(desc));
 
                 m_firstFrame = false;
                 m_accumulatedDeltaTime = 0.0f;
+                m_framesSinceUpdate = 0;
+                m_skippedTime = 0.0f;
             }
         }
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    bool ParticleEffectComponent::TryStartUpdate()
+    {
+        if (m_particleSystem->GetSchedulingMode() == ParticleSystem::SchedulingMode::k_frameDeterministic)
+        {
+            return true;
+        }
+
+        if (m_concurrentParticleData->StartUpdate() == true)
+        {
+            return true;
+        }
+
+        m_particleSystem->GetStats()->AddSkippedUpdate();
+        return false;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32 ParticleEffectComponent::CalculateInterpolationFactor() const
+    {
+        if (m_timeStep <= 0.0f || m_simulationCache != nullptr)
+        {
+            return 1.0f;
+        }
+
+        //the committed positions are those at the end of the last step, so are drawn a step behind to allow interpolation.
+        const Application* application = Application::Get();
+        const f32 timeSinceStep = f32(m_numUnsimulatedFixedUpdates) * application->GetUpdateInterval() + application->GetUpdateIntervalRemainder();
+        return MathUtils::Clamp(timeSinceStep / m_timeStep, 0.0f, 1.0f);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleEffectComponent::UpdateSimulationCachePlayback(f32 in_deltaTime)
+    {
+        CS_ASSERT(m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_local, "Simulation caches can only be used with local space particle effects.");
+        CS_ASSERT(m_simulationCache->GetMaxParticles() <= m_particleEffect->GetMaxParticles(), "Simulation cache contains more particles than the particle effect.");
+
+        if (m_playbackState == PlaybackState::k_notPlaying || m_simulationCache->GetNumFrames() == 0)
+        {
+            return;
+        }
+
+        if (m_playbackState == PlaybackState::k_starting)
+        {
+            m_playbackState = PlaybackState::k_playing;
+        }
+
+        m_simulationCacheTimer += in_deltaTime;
+
+        if (m_playbackState == PlaybackState::k_playing && m_playbackType == PlaybackType::k_once && m_simulationCacheTimer >= m_particleEffect->GetDuration())
+        {
+            StopEmitting();
+        }
+
+        u32 frameIndex = u32(m_simulationCacheTimer * m_simulationCache->GetFrameRate());
+        if (frameIndex >= m_simulationCache->GetNumFrames())
+        {
+            if (m_playbackState == PlaybackState::k_stopping || m_playbackType == PlaybackType::k_once)
+            {
+                Stop();
+                return;
+            }
+
+            m_simulationCacheTimer = std::fmod(m_simulationCacheTimer, m_simulationCache->GetDuration());
+            frameIndex = std::min(u32(m_simulationCacheTimer * m_simulationCache->GetFrameRate()), m_simulationCache->GetNumFrames() - 1);
+        }
+
+        //the cached data is committed on the main thread, so this can only fail if a simulated update is still in progress.
+        if (m_concurrentParticleData->StartUpdate() == true)
+        {
+            m_concurrentParticleData->CommitCachedParticleData(m_simulationCache.get(), frameIndex);
+            StoreLocalBoundingShapes();
+        }
+    }
     //-------------------------------------------------------
     //-------------------------------------------------------
     void ParticleEffectComponent::Render(RenderSystem* in_renderSystem, CameraComponent* in_camera, ShaderPass in_shaderPass)
@@ -642,7 +750,47 @@ namespace ChilliSource
         {
             CS_ASSERT(m_drawable != nullptr, "Cannot render without a drawable.");
 
-            m_drawable->Draw(in_camera);
+            m_renderedSinceUpdate = true;
+            SelectLodBand(in_camera);
+
+            m_drawable->Draw(in_camera, CalculateInterpolationFactor());
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleEffectComponent::SelectLodBand(CameraComponent* in_camera)
+    {
+        m_lodEmissionRateScale = 1.0f;
+        m_lodMaxParticlesScale = 1.0f;
+        m_lodUpdateInterval = 1;
+
+        if (m_particleEffect->GetLodBands().empty() == true || in_camera->GetEntity() == nullptr)
+        {
+            return;
+        }
+
+        const Sphere& boundingSphere = GetBoundingSphere();
+        const f32 distance = (boundingSphere.vOrigin - in_camera->GetEntity()->GetTransform().GetWorldPosition()).Length();
+
+        f32 metricValue = distance;
+        if (m_particleEffect->GetLodMetric() == ParticleEffect::LodMetric::k_projectedSize)
+        {
+            //the projected size is the fraction of the vertical viewport covered by the bounding sphere. This is only
+            //meaningful for perspective cameras so other cameras always use the highest level of detail.
+            metricValue = 1.0f;
+            if (in_camera->IsA<PerspectiveCameraComponent>() == true && distance > boundingSphere.fRadius)
+            {
+                const f32 halfFov = 0.5f * static_cast<PerspectiveCameraComponent*>(in_camera)->GetFieldOfView();
+                metricValue = boundingSphere.fRadius / (distance * std::tan(halfFov));
+            }
+        }
+
+        const ParticleEffect::LodBand* lodBand = m_particleEffect->SelectLodBand(metricValue);
+        if (lodBand != nullptr)
+        {
+            m_lodEmissionRateScale = lodBand->m_emissionRateScale;
+            m_lodMaxParticlesScale = lodBand->m_maxParticlesScale;
+            m_lodUpdateInterval = lodBand->m_updateInterval;
         }
     }
     //----------------------------------------------------------------
@@ -108,6 +108,19 @@ namespace ChilliSource
         //----------------------------------------------------------------
         ParticleEffectCSPtr GetParticleEffect() const;
         //----------------------------------------------------------------
+        /// Returns the simulation cache used to play back the effect, if
+        /// any.
+        ///
+        /// This is not thread-safe and should only be called on the main
+        /// thread.
+        ///
+        /// @author agent
+        /// 
+        /// @return The simulation cache. This will be null if the effect
+        /// is being simulated.
+        //----------------------------------------------------------------
+        ParticleSimulationCacheCSPtr GetSimulationCache() const;
+        //----------------------------------------------------------------
         /// Returns the current playback type. 
         ///
         /// This is not thread-safe and should only be called on the main
@@ -145,6 +158,20 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool IsEmitting() const;
         //----------------------------------------------------------------
+        /// Returns the number of particle emissions that have been dropped
+        /// since the particle effect was set because there were no free
+        /// particles. If this is regularly non-zero the max particles
+        /// of the effect should be increased.
+        ///
+        /// This is not thread-safe and should only be called on the main
+        /// thread.
+        ///
+        /// @author agent
+        ///
+        /// @return The number of dropped emissions.
+        //----------------------------------------------------------------
+        u32 GetNumDroppedEmissions() const;
+        //----------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @return The world space AABB of the effect.
@@ -177,6 +204,25 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetParticleEffect(const ParticleEffectCSPtr& in_particleEffect);
         //----------------------------------------------------------------
+        /// Sets a simulation cache which will be played back instead of
+        /// simulating the particle effect. The cache must have been baked
+        /// from the current particle effect, and the effect must be in
+        /// local simulation space. Setting the cache to null will return
+        /// to simulating the effect, the next time it starts playing.
+        ///
+        /// When playing a cache, a looping effect will loop the cache and
+        /// once an effect has stopped emitting, the remainder of the cache
+        /// is played.
+        ///
+        /// This is not thread-safe and should only be called on the main
+        /// thread.
+        /// 
+        /// @author agent
+        ///
+        /// @param The simulation cache.
+        //----------------------------------------------------------------
+        void SetSimulationCache(const ParticleSimulationCacheCSPtr& in_simulationCache);
+        //----------------------------------------------------------------
         /// Sets the playback mode that should be used when playing this 
         /// particle effect.
         ///
@@ -189,7 +235,9 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetPlaybackType(PlaybackType in_playbackType);
         //----------------------------------------------------------------
-        /// Starts the particle effect playing.
+        /// Starts the particle effect playing. If the effect is looping
+        /// and has a prewarm duration, it will start as if it had already
+        /// been playing for that long.
         ///
         /// This is not thread-safe and should only be called on the main
         /// thread.
@@ -307,7 +355,8 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// Called every frame the particle effect is in the scene. This
         /// will update depending on the current playback state of the
-        /// effect.
+        /// effect. If the particle system uses fixed time steps, only
+        /// whole steps are simulated and the given delta time is ignored.
         ///
         /// @author Ian Copland
         ///
@@ -315,9 +364,20 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void OnUpdate(f32 in_deltaTime) override;
         //----------------------------------------------------------------
+        /// Called for each application fixed update while the particle
+        /// effect is in the scene. If the particle system uses fixed time
+        /// steps, these drive the simulation.
+        ///
+        /// @author agent
+        ///
+        /// @param The fixed delta time.
+        //----------------------------------------------------------------
+        void OnFixedUpdate(f32 in_fixedDeltaTime) override;
+        //----------------------------------------------------------------
         /// Updates while the particle effect is starting. This will wait
         /// until an appropriate time to send a background task to initialise 
-        /// the particles and start updating.
+        /// the particles and start updating. The first update of a looping
+        /// effect will prewarm the particles if requested.
         ///
         /// @author Ian Copland
         ///
@@ -325,7 +385,11 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void UpdateStartingState(f32 in_deltaTime);
         //----------------------------------------------------------------
-        /// This will fire off a new particle update background task.
+        /// This will fire off a new particle update background task. The
+        /// update rate is limited by the current level of detail band and
+        /// if the effect was not rendered last frame then only the playback
+        /// time is advanced. The skipped time is caught up by the next
+        /// simulated update.
         ///
         /// @author Ian Copland
         ///
@@ -342,7 +406,50 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void UpdateStoppingState(f32 in_deltaTime);
         //----------------------------------------------------------------
-        /// Called when the component should render all particles.
+        /// Tries to start a simulated update of the particle effect. If
+        /// the previous update hasn't finished this fails and the skipped
+        /// update is recorded. In the frame deterministic scheduling mode
+        /// this always succeeds, as the update is started by the particle
+        /// system when it is scheduled.
+        ///
+        /// @author agent
+        ///
+        /// @return Whether or not an update can be queued.
+        //----------------------------------------------------------------
+        bool TryStartUpdate();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The fraction of the way through the current fixed time
+        /// step the frame is, which particle positions are interpolated
+        /// by when drawn. This is always one if fixed time steps are not
+        /// used.
+        //----------------------------------------------------------------
+        f32 CalculateInterpolationFactor() const;
+        //----------------------------------------------------------------
+        /// Updates playback of the simulation cache. This commits the
+        /// cached frame for the current playback time directly to the
+        /// concurrent particle data rather than simulating the effect.
+        ///
+        /// @author agent
+        ///
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void UpdateSimulationCachePlayback(f32 in_deltaTime);
+        //----------------------------------------------------------------
+        /// Selects the level of detail band for the particle effect based
+        /// on the metric described by the particle effect, measured from
+        /// the given camera.
+        ///
+        /// @author agent
+        ///
+        /// @param The camera the effect is being rendered with.
+        //----------------------------------------------------------------
+        void SelectLodBand(CameraComponent* in_camera);
+        //----------------------------------------------------------------
+        /// Called when the component should render all particles. This
+        /// also records that the effect is visible and selects the level
+        /// of detail band for the next update.
         ///
         /// @author Ian Copland
         ///
@@ -387,12 +494,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void OnRemovedFromEntity() override;
 
+        ParticleSystem* m_particleSystem = nullptr;
         ParticleEffectCSPtr m_particleEffect;
         ParticleDrawableUPtr m_drawable;
         ParticleEmitterSPtr m_emitter;
         std::vector<ParticleAffectorSPtr> m_affectors;
-        std::shared_ptr<dynamic_array<Particle>> m_particleArray;
+        ParticleArraySPtr m_particleArray;
         ConcurrentParticleDataSPtr m_concurrentParticleData;
+        ParticleSimulationCacheCSPtr m_simulationCache;
+        f32 m_simulationCacheTimer = 0.0f;
 
         PlaybackType m_playbackType = PlaybackType::k_once;
         PlaybackState m_playbackState = PlaybackState::k_notPlaying;
@@ -401,6 +511,17 @@ namespace ChilliSource
         Event<Delegate> m_finishedEvent;
         Event<Delegate> m_finishedEmittingEvent;
         bool m_firstFrame = false;
+        f32 m_pendingPrewarmDuration = 0.0f;
+
+        f32 m_lodEmissionRateScale = 1.0f;
+        f32 m_lodMaxParticlesScale = 1.0f;
+        u32 m_lodUpdateInterval = 1;
+        bool m_renderedSinceUpdate = false;
+        bool m_visible = true;
+        u32 m_framesSinceUpdate = 0;
+        f32 m_skippedTime = 0.0f;
+        u32 m_numUnsimulatedFixedUpdates = 0;
+        f32 m_timeStep = 0.0f;
 
         AABB m_localAABB;
         Sphere m_localBoundingSphere;
@@ -0,0 +1,161 @@
+//
+//  ParticleEffectPool.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleEffectPool.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleEffectPool::ParticleEffectPool(const ParticleEffectCSPtr& in_particleEffect, u32 in_numInstances)
+        : m_particleEffect(in_particleEffect)
+    {
+        CS_ASSERT(m_particleEffect != nullptr, "Cannot create a particle effect pool with a null particle effect.");
+
+        Reserve(in_numInstances);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    const ParticleEffectCSPtr& ParticleEffectPool::GetParticleEffect() const
+    {
+        return m_particleEffect;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleEffectPool::GetNumInstances() const
+    {
+        return u32(m_instances.size());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleEffectPool::GetNumActiveInstances() const
+    {
+        return u32(m_instances.size() - m_availableInstances.size());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleEffectPool::Reserve(u32 in_numInstances)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Particle effect pools must be used on the main thread.");
+
+        m_instances.reserve(in_numInstances);
+        m_availableInstances.reserve(in_numInstances);
+
+        while (m_instances.size() < in_numInstances)
+        {
+            CreateInstance();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleEffectComponent* ParticleEffectPool::Play(Scene* in_scene, const Vector3& in_position, const Quaternion& in_orientation, const Vector3& in_scale, ParticleEffectComponent::PlaybackType in_playbackType)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Particle effect pools must be used on the main thread.");
+        CS_ASSERT(in_scene != nullptr, "Cannot play a pooled particle effect in a null scene.");
+
+        if (m_availableInstances.empty() == true)
+        {
+            CreateInstance();
+        }
+
+        const u32 instanceIndex = m_availableInstances.back();
+        m_availableInstances.pop_back();
+
+        Instance& instance = m_instances[instanceIndex];
+        CS_ASSERT(instance.m_component->IsPlaying() == false, "Pooled particle effect instance is still playing.");
+
+        instance.m_entity->GetTransform().SetPositionScaleOrientation(in_position, in_scale, in_orientation);
+        instance.m_component->SetPlaybackType(in_playbackType);
+
+        //instances which are already in the scene are played in place; otherwise adding to the scene starts playback.
+        if (instance.m_entity->GetScene() == in_scene)
+        {
+            instance.m_component->Play();
+        }
+        else
+        {
+            if (instance.m_entity->GetScene() != nullptr)
+            {
+                instance.m_entity->RemoveFromParent();
+            }
+
+            in_scene->Add(instance.m_entity);
+        }
+
+        return instance.m_component;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleEffectPool::CreateInstance()
+    {
+        const u32 instanceIndex = u32(m_instances.size());
+
+        ParticleEffectComponentSPtr component = std::make_shared<ParticleEffectComponent>(m_particleEffect);
+
+        Instance instance;
+        instance.m_component = component.get();
+        instance.m_entity = Entity::Create();
+        instance.m_entity->AddComponent(component);
+        instance.m_finishedConnection = component->GetFinishedEvent().OpenConnection([=](ParticleEffectComponent* in_component)
+        {
+            OnInstanceFinished(instanceIndex);
+        });
+
+        m_instances.push_back(std::move(instance));
+        m_availableInstances.push_back(instanceIndex);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleEffectPool::OnInstanceFinished(u32 in_instanceIndex)
+    {
+        CS_ASSERT(std::find(m_availableInstances.begin(), m_availableInstances.end(), in_instanceIndex) == m_availableInstances.end(), "Pooled particle effect instance finished while available.");
+
+        m_availableInstances.push_back(in_instanceIndex);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleEffectPool::~ParticleEffectPool()
+    {
+        for (auto& instance : m_instances)
+        {
+            instance.m_finishedConnection.reset();
+
+            if (instance.m_entity->GetScene() != nullptr)
+            {
+                instance.m_entity->RemoveFromParent();
+            }
+        }
+    }
+}
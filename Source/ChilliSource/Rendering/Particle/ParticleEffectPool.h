@@ -0,0 +1,165 @@
+//
+//  ParticleEffectPool.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEEFFECTPOOL_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEEFFECTPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A pool of ready to play instances of a single particle effect. Each
+    /// instance is an entity with a fully prepared particle effect
+    /// component, so playing a pooled instance doesn't allocate the
+    /// particle storage, drawable, emitter or affectors again. This is
+    /// intended for short lived "fire and forget" effects such as impacts
+    /// which are played many times.
+    ///
+    /// Instances are returned to the pool when their effect finishes. A
+    /// finished instance stays in the scene it was played in, doing
+    /// nothing, until it is next played, so that reusing it in the same
+    /// scene doesn't need to add or remove the entity. All instances are
+    /// removed from their scene when the pool is destroyed.
+    ///
+    /// This is not thread-safe and must only be used on the main thread.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleEffectPool final
+    {
+    public:
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect that will be pooled.
+        /// @param The number of instances to create up front.
+        //----------------------------------------------------------------
+        ParticleEffectPool(const ParticleEffectCSPtr& in_particleEffect, u32 in_numInstances = 0);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The particle effect that is pooled.
+        //----------------------------------------------------------------
+        const ParticleEffectCSPtr& GetParticleEffect() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total number of instances in the pool.
+        //----------------------------------------------------------------
+        u32 GetNumInstances() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of instances which are currently playing.
+        //----------------------------------------------------------------
+        u32 GetNumActiveInstances() const;
+        //----------------------------------------------------------------
+        /// Creates new instances until the pool contains at least the
+        /// given number.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of instances.
+        //----------------------------------------------------------------
+        void Reserve(u32 in_numInstances);
+        //----------------------------------------------------------------
+        /// Plays the particle effect at the given transform using an
+        /// available instance, creating a new one if none are available.
+        /// The instance is added to the given scene if it isn't already in
+        /// it and is returned to the pool once it has finished.
+        ///
+        /// The returned component can be used to control the effect, but
+        /// must not be removed from its entity and shouldn't be held onto
+        /// after the finished event has fired.
+        ///
+        /// @author agent
+        ///
+        /// @param The scene to play the effect in.
+        /// @param The world position.
+        /// @param [Optional] The world orientation. Defaults to identity.
+        /// @param [Optional] The world scale. Defaults to one.
+        /// @param [Optional] The playback type. Defaults to once.
+        ///
+        /// @return The particle effect component that is playing.
+        //----------------------------------------------------------------
+        ParticleEffectComponent* Play(Scene* in_scene, const Vector3& in_position, const Quaternion& in_orientation = Quaternion::k_identity, const Vector3& in_scale = Vector3::k_one,
+            ParticleEffectComponent::PlaybackType in_playbackType = ParticleEffectComponent::PlaybackType::k_once);
+        //----------------------------------------------------------------
+        /// Destructor. Removes all instances from their scenes.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ~ParticleEffectPool();
+    private:
+        //----------------------------------------------------------------
+        /// A single pooled instance of the particle effect.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct Instance final
+        {
+            EntitySPtr m_entity;
+            ParticleEffectComponent* m_component = nullptr;
+            EventConnectionUPtr m_finishedConnection;
+        };
+
+        ParticleEffectPool(const ParticleEffectPool&) = delete;
+        ParticleEffectPool& operator=(const ParticleEffectPool&) = delete;
+        //----------------------------------------------------------------
+        /// Creates a new instance and adds it to the list of available
+        /// instances.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void CreateInstance();
+        //----------------------------------------------------------------
+        /// Called when a pooled particle effect finishes. This returns
+        /// the instance to the pool.
+        ///
+        /// @author agent
+        ///
+        /// @param The index of the instance.
+        //----------------------------------------------------------------
+        void OnInstanceFinished(u32 in_instanceIndex);
+
+        ParticleEffectCSPtr m_particleEffect;
+        std::vector<Instance> m_instances;
+        std::vector<u32> m_availableInstances;
+    };
+}
+
+#endif
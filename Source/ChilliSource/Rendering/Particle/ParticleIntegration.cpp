@@ -0,0 +1,436 @@
+//
+//  ParticleIntegration.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleIntegration.h>
+
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CS_PARTICLEINTEGRATION_SSE2
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#   define CS_PARTICLEINTEGRATION_NEON
+#   include <arm_neon.h>
+#endif
+
+#include <cstring>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace ParticleIntegration
+    {
+        namespace
+        {
+            static_assert(sizeof(Vector3) == 3 * sizeof(f32), "Vectorised particle integration requires Vector3 to be tightly packed.");
+            static_assert(sizeof(bool) == 1, "Vectorised particle integration requires bool to be a single byte.");
+
+            const u32 k_batchSize = 4;
+
+            //----------------------------------------------------------------
+            /// Integrates the particles in the given range one at a time.
+            /// If requested, the bounds are expanded to contain every
+            /// particle which is still alive after integration.
+            ///
+            /// @author agent
+            ///
+            /// @param The particle array.
+            /// @param The index of the first particle to integrate.
+            /// @param The index after the last particle to integrate.
+            /// @param The delta time.
+            /// @param [In/Out] The minimum of the bounds.
+            /// @param [In/Out] The maximum of the bounds.
+            //----------------------------------------------------------------
+            template <bool TCalculateBounds> void IntegrateRangeScalar(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+            {
+                dynamic_array<bool>& activeFlags = inout_particleArray->GetActiveFlags();
+                dynamic_array<f32>& energies = inout_particleArray->GetEnergies();
+                dynamic_array<Vector3>& positions = inout_particleArray->GetPositions();
+                dynamic_array<f32>& rotations = inout_particleArray->GetRotations();
+                const dynamic_array<Vector3>& velocities = inout_particleArray->GetVelocities();
+                const dynamic_array<f32>& angularVelocities = inout_particleArray->GetAngularVelocities();
+
+                for (u32 i = in_start; i < in_end; ++i)
+                {
+                    if (activeFlags[i] == true)
+                    {
+                        energies[i] -= in_deltaTime;
+                        if (energies[i] > 0.0f)
+                        {
+                            positions[i] += velocities[i] * in_deltaTime;
+                            rotations[i] += angularVelocities[i] * in_deltaTime;
+
+                            if (TCalculateBounds == true)
+                            {
+                                inout_min.Min(positions[i]);
+                                inout_max.Max(positions[i]);
+                            }
+                        }
+                        else
+                        {
+                            energies[i] = 0.0f;
+                            activeFlags[i] = false;
+                        }
+                    }
+                }
+            }
+
+#if defined(CS_PARTICLEINTEGRATION_SSE2)
+            //----------------------------------------------------------------
+            /// @author agent
+            ///
+            /// @param The mask.
+            /// @param The value to use where the mask is set.
+            /// @param The value to use where the mask is not set.
+            ///
+            /// @return The lane-wise selection of the two values.
+            //----------------------------------------------------------------
+            inline __m128 Select(__m128 in_mask, __m128 in_a, __m128 in_b)
+            {
+                return _mm_or_ps(_mm_and_ps(in_mask, in_a), _mm_andnot_ps(in_mask, in_b));
+            }
+            //----------------------------------------------------------------
+            /// Integrates as many particles as possible in batches of four
+            /// using SSE2. The liveness of each lane is decided by a mask
+            /// rather than a branch, so expiring particles are handled
+            /// without leaving the vectorised path. If requested, the
+            /// bounds of the live particles are accumulated in registers
+            /// and only reduced once the range has been integrated.
+            ///
+            /// @author agent
+            ///
+            /// @param The particle array.
+            /// @param The index of the first particle to integrate.
+            /// @param The index after the last particle to integrate.
+            /// @param The delta time.
+            /// @param [In/Out] The minimum of the bounds.
+            /// @param [In/Out] The maximum of the bounds.
+            ///
+            /// @return The index after the last particle that was
+            /// integrated. The number of particles integrated will always
+            /// be a multiple of the batch size.
+            //----------------------------------------------------------------
+            template <bool TCalculateBounds> u32 IntegrateBatched(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+            {
+                const u32 batchedEnd = in_end - ((in_end - in_start) % k_batchSize);
+                if (batchedEnd == in_start)
+                {
+                    return in_start;
+                }
+
+                bool* activeFlags = inout_particleArray->GetActiveFlags().data();
+                f32* energies = inout_particleArray->GetEnergies().data();
+                f32* positions = reinterpret_cast<f32*>(inout_particleArray->GetPositions().data());
+                f32* rotations = inout_particleArray->GetRotations().data();
+                const f32* velocities = reinterpret_cast<const f32*>(inout_particleArray->GetVelocities().data());
+                const f32* angularVelocities = inout_particleArray->GetAngularVelocities().data();
+
+                const __m128 deltaTime = _mm_set1_ps(in_deltaTime);
+                const __m128 zero = _mm_setzero_ps();
+                const __m128i zeroInt = _mm_setzero_si128();
+                const __m128 lowest = _mm_set1_ps(-std::numeric_limits<f32>::max());
+                const __m128 highest = _mm_set1_ps(std::numeric_limits<f32>::max());
+
+                //the bounds are accumulated per interleaved component, in the same layout as the positions.
+                __m128 boundsMins[3] = { highest, highest, highest };
+                __m128 boundsMaxs[3] = { lowest, lowest, lowest };
+
+                for (u32 i = in_start; i < batchedEnd; i += k_batchSize)
+                {
+                    //expand the four active flags into a lane mask.
+                    s32 packedFlags = 0;
+                    std::memcpy(&packedFlags, activeFlags + i, k_batchSize);
+                    if (packedFlags == 0)
+                    {
+                        continue;
+                    }
+
+                    __m128i flags = _mm_cvtsi32_si128(packedFlags);
+                    flags = _mm_unpacklo_epi8(flags, zeroInt);
+                    flags = _mm_unpacklo_epi16(flags, zeroInt);
+                    const __m128 active = _mm_castsi128_ps(_mm_cmpgt_epi32(flags, zeroInt));
+
+                    //update energy, deactivating any particles that have run out.
+                    const __m128 energy = _mm_loadu_ps(energies + i);
+                    const __m128 reducedEnergy = _mm_sub_ps(energy, deltaTime);
+                    const __m128 alive = _mm_and_ps(active, _mm_cmpgt_ps(reducedEnergy, zero));
+                    _mm_storeu_ps(energies + i, Select(alive, reducedEnergy, Select(active, zero, energy)));
+
+                    const s32 aliveBits = _mm_movemask_ps(alive);
+                    activeFlags[i + 0] = (aliveBits & 0x1) != 0;
+                    activeFlags[i + 1] = (aliveBits & 0x2) != 0;
+                    activeFlags[i + 2] = (aliveBits & 0x4) != 0;
+                    activeFlags[i + 3] = (aliveBits & 0x8) != 0;
+
+                    if (aliveBits == 0)
+                    {
+                        continue;
+                    }
+
+                    //update rotation.
+                    const __m128 rotation = _mm_loadu_ps(rotations + i);
+                    const __m128 angularVelocity = _mm_loadu_ps(angularVelocities + i);
+                    _mm_storeu_ps(rotations + i, Select(alive, _mm_add_ps(rotation, _mm_mul_ps(angularVelocity, deltaTime)), rotation));
+
+                    //update position. The four positions are stored as twelve interleaved components so
+                    //the alive mask is expanded to cover each component: [0 0 0 1], [1 1 2 2], [2 3 3 3].
+                    const __m128 aliveMasks[3] =
+                    {
+                        _mm_shuffle_ps(alive, alive, _MM_SHUFFLE(1, 0, 0, 0)),
+                        _mm_shuffle_ps(alive, alive, _MM_SHUFFLE(2, 2, 1, 1)),
+                        _mm_shuffle_ps(alive, alive, _MM_SHUFFLE(3, 3, 3, 2))
+                    };
+
+                    f32* position = positions + i * 3;
+                    const f32* velocity = velocities + i * 3;
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        const __m128 positionComponents = _mm_loadu_ps(position + component * 4);
+                        const __m128 velocityComponents = _mm_loadu_ps(velocity + component * 4);
+                        const __m128 newPositionComponents = _mm_add_ps(positionComponents, _mm_mul_ps(velocityComponents, deltaTime));
+                        _mm_storeu_ps(position + component * 4, Select(aliveMasks[component], newPositionComponents, positionComponents));
+
+                        if (TCalculateBounds == true)
+                        {
+                            boundsMins[component] = _mm_min_ps(boundsMins[component], Select(aliveMasks[component], newPositionComponents, highest));
+                            boundsMaxs[component] = _mm_max_ps(boundsMaxs[component], Select(aliveMasks[component], newPositionComponents, lowest));
+                        }
+                    }
+                }
+
+                if (TCalculateBounds == true)
+                {
+                    //the twelve accumulated values follow the x, y, z pattern of the positions.
+                    f32 mins[3 * k_batchSize];
+                    f32 maxs[3 * k_batchSize];
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        _mm_storeu_ps(mins + component * 4, boundsMins[component]);
+                        _mm_storeu_ps(maxs + component * 4, boundsMaxs[component]);
+                    }
+
+                    for (u32 j = 0; j < 3 * k_batchSize; j += 3)
+                    {
+                        inout_min.Min(Vector3(mins[j], mins[j + 1], mins[j + 2]));
+                        inout_max.Max(Vector3(maxs[j], maxs[j + 1], maxs[j + 2]));
+                    }
+                }
+
+                return batchedEnd;
+            }
+#elif defined(CS_PARTICLEINTEGRATION_NEON)
+            //----------------------------------------------------------------
+            /// Integrates as many particles as possible in batches of four
+            /// using NEON. The liveness of each lane is decided by a mask
+            /// rather than a branch, so expiring particles are handled
+            /// without leaving the vectorised path. If requested, the
+            /// bounds of the live particles are accumulated in registers
+            /// and only reduced once the range has been integrated.
+            ///
+            /// @author agent
+            ///
+            /// @param The particle array.
+            /// @param The index of the first particle to integrate.
+            /// @param The index after the last particle to integrate.
+            /// @param The delta time.
+            /// @param [In/Out] The minimum of the bounds.
+            /// @param [In/Out] The maximum of the bounds.
+            ///
+            /// @return The index after the last particle that was
+            /// integrated. The number of particles integrated will always
+            /// be a multiple of the batch size.
+            //----------------------------------------------------------------
+            template <bool TCalculateBounds> u32 IntegrateBatched(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+            {
+                const u32 batchedEnd = in_end - ((in_end - in_start) % k_batchSize);
+                if (batchedEnd == in_start)
+                {
+                    return in_start;
+                }
+
+                bool* activeFlags = inout_particleArray->GetActiveFlags().data();
+                f32* energies = inout_particleArray->GetEnergies().data();
+                f32* positions = reinterpret_cast<f32*>(inout_particleArray->GetPositions().data());
+                f32* rotations = inout_particleArray->GetRotations().data();
+                const f32* velocities = reinterpret_cast<const f32*>(inout_particleArray->GetVelocities().data());
+                const f32* angularVelocities = inout_particleArray->GetAngularVelocities().data();
+
+                const float32x4_t deltaTime = vdupq_n_f32(in_deltaTime);
+                const float32x4_t zero = vdupq_n_f32(0.0f);
+                const float32x4_t lowest = vdupq_n_f32(-std::numeric_limits<f32>::max());
+                const float32x4_t highest = vdupq_n_f32(std::numeric_limits<f32>::max());
+
+                float32x4_t boundsMins[3] = { highest, highest, highest };
+                float32x4_t boundsMaxs[3] = { lowest, lowest, lowest };
+
+                for (u32 i = in_start; i < batchedEnd; i += k_batchSize)
+                {
+                    //expand the four active flags into a lane mask.
+                    u32 packedFlags = 0;
+                    std::memcpy(&packedFlags, activeFlags + i, k_batchSize);
+                    if (packedFlags == 0)
+                    {
+                        continue;
+                    }
+
+                    const u32 flags[k_batchSize] = { activeFlags[i + 0], activeFlags[i + 1], activeFlags[i + 2], activeFlags[i + 3] };
+                    const uint32x4_t active = vcgtq_u32(vld1q_u32(flags), vdupq_n_u32(0));
+
+                    //update energy, deactivating any particles that have run out.
+                    const float32x4_t energy = vld1q_f32(energies + i);
+                    const float32x4_t reducedEnergy = vsubq_f32(energy, deltaTime);
+                    const uint32x4_t alive = vandq_u32(active, vcgtq_f32(reducedEnergy, zero));
+                    vst1q_f32(energies + i, vbslq_f32(alive, reducedEnergy, vbslq_f32(active, zero, energy)));
+
+                    activeFlags[i + 0] = vgetq_lane_u32(alive, 0) != 0;
+                    activeFlags[i + 1] = vgetq_lane_u32(alive, 1) != 0;
+                    activeFlags[i + 2] = vgetq_lane_u32(alive, 2) != 0;
+                    activeFlags[i + 3] = vgetq_lane_u32(alive, 3) != 0;
+
+                    //update rotation.
+                    const float32x4_t rotation = vld1q_f32(rotations + i);
+                    const float32x4_t angularVelocity = vld1q_f32(angularVelocities + i);
+                    vst1q_f32(rotations + i, vbslq_f32(alive, vaddq_f32(rotation, vmulq_f32(angularVelocity, deltaTime)), rotation));
+
+                    //update position. The positions are de-interleaved on load so each register holds a single component.
+                    float32x4x3_t position = vld3q_f32(positions + i * 3);
+                    const float32x4x3_t velocity = vld3q_f32(velocities + i * 3);
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        const float32x4_t newPosition = vaddq_f32(position.val[component], vmulq_f32(velocity.val[component], deltaTime));
+                        position.val[component] = vbslq_f32(alive, newPosition, position.val[component]);
+
+                        if (TCalculateBounds == true)
+                        {
+                            boundsMins[component] = vminq_f32(boundsMins[component], vbslq_f32(alive, newPosition, highest));
+                            boundsMaxs[component] = vmaxq_f32(boundsMaxs[component], vbslq_f32(alive, newPosition, lowest));
+                        }
+                    }
+                    vst3q_f32(positions + i * 3, position);
+                }
+
+                if (TCalculateBounds == true)
+                {
+                    f32 mins[3][k_batchSize];
+                    f32 maxs[3][k_batchSize];
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        vst1q_f32(mins[component], boundsMins[component]);
+                        vst1q_f32(maxs[component], boundsMaxs[component]);
+                    }
+
+                    for (u32 lane = 0; lane < k_batchSize; ++lane)
+                    {
+                        inout_min.Min(Vector3(mins[0][lane], mins[1][lane], mins[2][lane]));
+                        inout_max.Max(Vector3(maxs[0][lane], maxs[1][lane], maxs[2][lane]));
+                    }
+                }
+
+                return batchedEnd;
+            }
+#else
+            //----------------------------------------------------------------
+            /// Vectorised integration is not supported on this architecture
+            /// so no particles are integrated in batches.
+            ///
+            /// @author agent
+            ///
+            /// @param The particle array.
+            /// @param The index of the first particle to integrate.
+            /// @param The index after the last particle to integrate.
+            /// @param The delta time.
+            /// @param [In/Out] The minimum of the bounds.
+            /// @param [In/Out] The maximum of the bounds.
+            ///
+            /// @return The index after the last particle that was
+            /// integrated.
+            //----------------------------------------------------------------
+            template <bool TCalculateBounds> u32 IntegrateBatched(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+            {
+                return in_start;
+            }
+#endif
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Integrate(ParticleArray* inout_particleArray, f32 in_deltaTime)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+
+            IntegrateRange(inout_particleArray, 0, inout_particleArray->GetNumActiveParticles(), in_deltaTime);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Integrate(ParticleArray* inout_particleArray, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+
+            IntegrateRange(inout_particleArray, 0, inout_particleArray->GetNumActiveParticles(), in_deltaTime, inout_min, inout_max);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void IntegrateRange(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+            CS_ASSERT(in_start <= in_end && in_end <= inout_particleArray->GetNumActiveParticles(), "Integration range out of bounds.");
+
+            //the bounds are ignored, so a single placeholder is used for both.
+            Vector3 unusedBounds;
+            const u32 batchedEnd = IntegrateBatched<false>(inout_particleArray, in_start, in_end, in_deltaTime, unusedBounds, unusedBounds);
+            IntegrateRangeScalar<false>(inout_particleArray, batchedEnd, in_end, in_deltaTime, unusedBounds, unusedBounds);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void IntegrateRange(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+            CS_ASSERT(in_start <= in_end && in_end <= inout_particleArray->GetNumActiveParticles(), "Integration range out of bounds.");
+
+            const u32 batchedEnd = IntegrateBatched<true>(inout_particleArray, in_start, in_end, in_deltaTime, inout_min, inout_max);
+            IntegrateRangeScalar<true>(inout_particleArray, batchedEnd, in_end, in_deltaTime, inout_min, inout_max);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void IntegrateScalar(ParticleArray* inout_particleArray, f32 in_deltaTime)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+
+            Vector3 unusedBounds;
+            IntegrateRangeScalar<false>(inout_particleArray, 0, inout_particleArray->GetNumActiveParticles(), in_deltaTime, unusedBounds, unusedBounds);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void IntegrateScalar(ParticleArray* inout_particleArray, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max)
+        {
+            CS_ASSERT(inout_particleArray != nullptr, "Cannot integrate a null particle array.");
+
+            IntegrateRangeScalar<true>(inout_particleArray, 0, inout_particleArray->GetNumActiveParticles(), in_deltaTime, inout_min, inout_max);
+        }
+    }
+}
\ No newline at end of file
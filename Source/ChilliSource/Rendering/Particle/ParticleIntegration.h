@@ -0,0 +1,143 @@
+//
+//  ParticleIntegration.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEINTEGRATION_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEINTEGRATION_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A collection of methods for integrating the state of the particles
+    /// in a particle array over time.
+    ///
+    /// Where supported by the target architecture the particles are
+    /// processed in batches of four using SSE2 or NEON, otherwise a scalar
+    /// path is used. All paths produce the same results.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    namespace ParticleIntegration
+    {
+        //----------------------------------------------------------------
+        /// Integrates all active particles in the given array over the
+        /// given time step. The energy of each particle is reduced by the
+        /// delta time, and any particle which runs out of energy is
+        /// deactivated. Particles which remain active have their position
+        /// and rotation updated from their velocity and angular velocity.
+        ///
+        /// Deactivated particles are not removed from the array; this
+        /// is left to the caller so any associated per-particle data can
+        /// be moved at the same time.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void Integrate(ParticleArray* inout_particleArray, f32 in_deltaTime);
+        //----------------------------------------------------------------
+        /// Integrates all active particles in the given array over the
+        /// given time step, in the same way as Integrate(), while also
+        /// expanding the given bounds to contain the new position of
+        /// every particle which is still active. This avoids a second
+        /// pass over the positions to calculate the bounds.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The delta time.
+        /// @param [In/Out] The minimum of the bounds.
+        /// @param [In/Out] The maximum of the bounds.
+        //----------------------------------------------------------------
+        void Integrate(ParticleArray* inout_particleArray, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max);
+        //----------------------------------------------------------------
+        /// Integrates the active particles in the given range over the
+        /// given time step, in the same way as Integrate(). Particles
+        /// outside of the range are not touched, so disjoint ranges of
+        /// the same array can be integrated concurrently.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The index of the first particle to integrate.
+        /// @param The index after the last particle to integrate. This
+        /// cannot exceed the number of active particles.
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void IntegrateRange(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime);
+        //----------------------------------------------------------------
+        /// Integrates the active particles in the given range over the
+        /// given time step, in the same way as IntegrateRange(), while
+        /// also expanding the given bounds to contain the new position of
+        /// every particle in the range which is still active.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The index of the first particle to integrate.
+        /// @param The index after the last particle to integrate. This
+        /// cannot exceed the number of active particles.
+        /// @param The delta time.
+        /// @param [In/Out] The minimum of the bounds.
+        /// @param [In/Out] The maximum of the bounds.
+        //----------------------------------------------------------------
+        void IntegrateRange(ParticleArray* inout_particleArray, u32 in_start, u32 in_end, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max);
+        //----------------------------------------------------------------
+        /// Integrates all active particles in the given array over the
+        /// given time step, one particle at a time. This will give the 
+        /// same results as Integrate(), but will never use the vectorised
+        /// path.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void IntegrateScalar(ParticleArray* inout_particleArray, f32 in_deltaTime);
+        //----------------------------------------------------------------
+        /// Integrates all active particles in the given array over the
+        /// given time step and expands the given bounds, one particle at
+        /// a time. This will give the same results as the bounds
+        /// calculating overload of Integrate(), but will never use the
+        /// vectorised path.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The delta time.
+        /// @param [In/Out] The minimum of the bounds.
+        /// @param [In/Out] The maximum of the bounds.
+        //----------------------------------------------------------------
+        void IntegrateScalar(ParticleArray* inout_particleArray, f32 in_deltaTime, Vector3& inout_min, Vector3& inout_max);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,387 @@
+//
+//  ParticleMemoryManager.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr std::size_t k_overflowOffset = std::numeric_limits<std::size_t>::max();
+
+        //----------------------------------------------------------------
+        /// Allocates a block of memory from the heap with the given
+        /// alignment. The number of bytes skipped to align the block is
+        /// stored in the byte immediately before it so that the original
+        /// allocation can be recovered when it is freed.
+        ///
+        /// @author agent
+        ///
+        /// @param The size of the block in bytes.
+        /// @param The alignment of the block. This must be a power of two
+        /// no greater than 128.
+        ///
+        /// @return The aligned block.
+        //----------------------------------------------------------------
+        u8* AllocateAligned(std::size_t in_size, std::size_t in_alignment)
+        {
+            u8* memory = new u8[in_size + in_alignment];
+            const std::size_t adjustment = in_alignment - (reinterpret_cast<std::uintptr_t>(memory) & (in_alignment - 1));
+
+            u8* aligned = memory + adjustment;
+            aligned[-1] = u8(adjustment);
+            return aligned;
+        }
+        //----------------------------------------------------------------
+        /// Frees a block previously allocated with AllocateAligned().
+        ///
+        /// @author agent
+        ///
+        /// @param The aligned block.
+        //----------------------------------------------------------------
+        void DeallocateAligned(u8* in_memory)
+        {
+            if (in_memory != nullptr)
+            {
+                const std::size_t adjustment = in_memory[-1];
+                delete[] (in_memory - adjustment);
+            }
+        }
+
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The priority of an effect.
+        ///
+        /// @return The percentage of the global particle budget an effect
+        /// of the given priority can emit into.
+        //----------------------------------------------------------------
+        u64 GetBudgetPercentage(ParticleEffect::Priority in_priority)
+        {
+            switch (in_priority)
+            {
+            case ParticleEffect::Priority::k_low:
+                return 75;
+            case ParticleEffect::Priority::k_normal:
+                return 90;
+            case ParticleEffect::Priority::k_high:
+                return 100;
+            default:
+                CS_LOG_FATAL("Invalid particle effect priority.");
+                return 100;
+            }
+        }
+    }
+
+    constexpr std::size_t ParticleMemoryManager::k_defaultArenaSize;
+    constexpr u32 ParticleMemoryManager::k_unlimitedParticleBudget;
+    constexpr std::size_t ParticleMemoryManager::k_alignment;
+    constexpr std::size_t ParticleMemoryManager::k_headerSize;
+
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleMemoryManager::ParticleMemoryManager(std::size_t in_arenaSize, u32 in_particleBudget)
+        : m_arenaSize(in_arenaSize), m_particleBudget(in_particleBudget), m_numLiveParticles(0), m_peakLiveParticles(0), m_numThrottledParticles(0)
+    {
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    std::size_t ParticleMemoryManager::GetArenaSize() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_arenaSize;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleMemoryManager::SetArenaSize(std::size_t in_arenaSize)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        CS_ASSERT(m_numAllocations == 0, "Cannot resize the particle memory arena while it is in use.");
+
+        m_arenaSize = in_arenaSize;
+        DeallocateAligned(m_arena);
+        m_arena = nullptr;
+        m_freeBlocks = nullptr;
+        m_peakArenaUsage = 0;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::GetParticleBudget() const
+    {
+        return m_particleBudget.load(std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleMemoryManager::SetParticleBudget(u32 in_particleBudget)
+    {
+        m_particleBudget.store(in_particleBudget, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    std::size_t ParticleMemoryManager::GetArenaUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_arenaUsage;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    std::size_t ParticleMemoryManager::GetPeakArenaUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_peakArenaUsage;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    std::size_t ParticleMemoryManager::GetOverflowUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_overflowUsage;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::GetNumAllocations() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_numAllocations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u64 ParticleMemoryManager::GetTotalAllocations() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_totalAllocations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u64 ParticleMemoryManager::GetTotalOverflowAllocations() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_totalOverflowAllocations;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::GetNumLiveParticles() const
+    {
+        return m_numLiveParticles.load(std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::GetPeakLiveParticles() const
+    {
+        return m_peakLiveParticles.load(std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::GetNumThrottledParticles() const
+    {
+        return m_numThrottledParticles.load(std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleMemoryManager::ResetPeakStats()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_peakArenaUsage = m_arenaUsage;
+        m_peakLiveParticles.store(m_numLiveParticles.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleMemoryManager::ReserveParticles(u32 in_numParticles, ParticleEffect::Priority in_priority)
+    {
+        const u32 limit = u32((u64(m_particleBudget.load(std::memory_order_relaxed)) * GetBudgetPercentage(in_priority)) / 100);
+
+        u32 numLive = m_numLiveParticles.load(std::memory_order_relaxed);
+        u32 numReserved = 0;
+        do
+        {
+            const u32 numAvailable = (limit > numLive) ? limit - numLive : 0;
+            numReserved = std::min(in_numParticles, numAvailable);
+        }
+        while (numReserved > 0 && m_numLiveParticles.compare_exchange_weak(numLive, numLive + numReserved, std::memory_order_relaxed) == false);
+
+        if (numReserved < in_numParticles)
+        {
+            m_numThrottledParticles.fetch_add(in_numParticles - numReserved, std::memory_order_relaxed);
+        }
+
+        if (numReserved > 0)
+        {
+            const u32 newNumLive = numLive + numReserved;
+            u32 peak = m_peakLiveParticles.load(std::memory_order_relaxed);
+            while (newNumLive > peak && m_peakLiveParticles.compare_exchange_weak(peak, newNumLive, std::memory_order_relaxed) == false)
+            {
+            }
+        }
+
+        return numReserved;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleMemoryManager::ReleaseParticles(u32 in_numParticles)
+    {
+        CS_ASSERT(m_numLiveParticles.load(std::memory_order_relaxed) >= in_numParticles, "Cannot release more particles than have been reserved.");
+
+        m_numLiveParticles.fetch_sub(in_numParticles, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleMemoryManager::AllocationHeader* ParticleMemoryManager::Allocate(std::size_t in_size)
+    {
+        const std::size_t blockSize = ((in_size + k_alignment - 1) / k_alignment) * k_alignment;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (m_arena == nullptr && m_arenaSize >= k_alignment)
+        {
+            m_arenaSize = (m_arenaSize / k_alignment) * k_alignment;
+            m_arena = AllocateAligned(m_arenaSize, k_alignment);
+            m_freeBlocks = new (m_arena) FreeBlock();
+            m_freeBlocks->m_size = m_arenaSize;
+        }
+
+        //first fit, so allocations are packed towards the start of the arena.
+        u8* memory = nullptr;
+        std::size_t offset = k_overflowOffset;
+        for (FreeBlock** link = &m_freeBlocks; *link != nullptr; link = &(*link)->m_next)
+        {
+            FreeBlock* block = *link;
+            if (block->m_size >= blockSize)
+            {
+                const std::size_t remainingSize = block->m_size - blockSize;
+                memory = reinterpret_cast<u8*>(block);
+                offset = std::size_t(memory - m_arena);
+
+                if (remainingSize > 0)
+                {
+                    FreeBlock* remainder = new (memory + blockSize) FreeBlock();
+                    remainder->m_size = remainingSize;
+                    remainder->m_next = block->m_next;
+                    *link = remainder;
+                }
+                else
+                {
+                    *link = block->m_next;
+                }
+
+                block->~FreeBlock();
+                m_arenaUsage += blockSize;
+                m_peakArenaUsage = std::max(m_peakArenaUsage, m_arenaUsage);
+                break;
+            }
+        }
+
+        if (memory == nullptr)
+        {
+            CS_LOG_WARNING("Particle memory arena is full, falling back on the heap. Consider increasing the arena size.");
+
+            memory = AllocateAligned(blockSize, k_alignment);
+            m_overflowUsage += blockSize;
+            ++m_totalOverflowAllocations;
+        }
+
+        ++m_numAllocations;
+        ++m_totalAllocations;
+
+        AllocationHeader* header = new (memory) AllocationHeader();
+        header->m_owner = this;
+        header->m_offset = offset;
+        header->m_blockSize = blockSize;
+        return header;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleMemoryManager::Deallocate(AllocationHeader* in_header)
+    {
+        const std::size_t offset = in_header->m_offset;
+        const std::size_t blockSize = in_header->m_blockSize;
+        in_header->~AllocationHeader();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        CS_ASSERT(m_numAllocations > 0, "Cannot deallocate from an empty particle memory arena.");
+        --m_numAllocations;
+
+        if (offset == k_overflowOffset)
+        {
+            DeallocateAligned(reinterpret_cast<u8*>(in_header));
+            m_overflowUsage -= blockSize;
+            return;
+        }
+
+        m_arenaUsage -= blockSize;
+
+        //return the block to the free list, merging it with any adjacent free blocks.
+        u8* memory = m_arena + offset;
+        FreeBlock* previous = nullptr;
+        FreeBlock* next = m_freeBlocks;
+        while (next != nullptr && reinterpret_cast<u8*>(next) < memory)
+        {
+            previous = next;
+            next = next->m_next;
+        }
+
+        FreeBlock* block = new (memory) FreeBlock();
+        block->m_size = blockSize;
+        block->m_next = next;
+
+        if (next != nullptr && memory + blockSize == reinterpret_cast<u8*>(next))
+        {
+            block->m_size += next->m_size;
+            block->m_next = next->m_next;
+            next->~FreeBlock();
+        }
+
+        if (previous == nullptr)
+        {
+            m_freeBlocks = block;
+        }
+        else if (reinterpret_cast<u8*>(previous) + previous->m_size == memory)
+        {
+            previous->m_size += block->m_size;
+            previous->m_next = block->m_next;
+            block->~FreeBlock();
+        }
+        else
+        {
+            previous->m_next = block;
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleMemoryManager::~ParticleMemoryManager()
+    {
+        CS_ASSERT(m_numAllocations == 0, "Particle memory manager destroyed while particle storage is still allocated.");
+
+        DeallocateAligned(m_arena);
+    }
+}
@@ -0,0 +1,334 @@
+//
+//  ParticleMemoryManager.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEMEMORYMANAGER_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEMEMORYMANAGER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// Manages the memory used by all particle effects. All particle and
+    /// affector storage is sub-allocated from a single arena, which is
+    /// allocated the first time it is used. If the arena is full, storage
+    /// falls back to the heap and is reported as overflow so the arena can
+    /// be resized appropriately.
+    ///
+    /// This also enforces a global particle budget: the total number of
+    /// active particles across all effects. Emitters reserve particles
+    /// from the budget prior to emitting them, and emission is throttled
+    /// according to the priority of the effect once the budget starts to
+    /// run out.
+    ///
+    /// This is thread-safe.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleMemoryManager final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleMemoryManager);
+
+        static constexpr std::size_t k_defaultArenaSize = 8 * 1024 * 1024;
+        static constexpr u32 k_unlimitedParticleBudget = 0xffffffff;
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param [Optional] The size of the arena in bytes.
+        /// @param [Optional] The global particle budget. Defaults to
+        /// unlimited.
+        //----------------------------------------------------------------
+        ParticleMemoryManager(std::size_t in_arenaSize = k_defaultArenaSize, u32 in_particleBudget = k_unlimitedParticleBudget);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The size of the arena in bytes.
+        //----------------------------------------------------------------
+        std::size_t GetArenaSize() const;
+        //----------------------------------------------------------------
+        /// Sets the size of the arena. This can only be called while
+        /// there is no live storage allocated by the manager.
+        ///
+        /// @author agent
+        ///
+        /// @param The size of the arena in bytes.
+        //----------------------------------------------------------------
+        void SetArenaSize(std::size_t in_arenaSize);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The global particle budget.
+        //----------------------------------------------------------------
+        u32 GetParticleBudget() const;
+        //----------------------------------------------------------------
+        /// Sets the global particle budget. If the budget is reduced below
+        /// the number of live particles, existing particles are unaffected
+        /// but no further particles will be emitted until enough have
+        /// died.
+        ///
+        /// @author agent
+        ///
+        /// @param The global particle budget.
+        //----------------------------------------------------------------
+        void SetParticleBudget(u32 in_particleBudget);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of bytes of the arena which are currently
+        /// allocated, including allocation headers.
+        //----------------------------------------------------------------
+        std::size_t GetArenaUsage() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The highest number of bytes of the arena which have
+        /// been allocated at once.
+        //----------------------------------------------------------------
+        std::size_t GetPeakArenaUsage() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of bytes currently allocated from the heap
+        /// because the arena was full.
+        //----------------------------------------------------------------
+        std::size_t GetOverflowUsage() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of allocations which are currently live,
+        /// both in the arena and overflowed to the heap.
+        //----------------------------------------------------------------
+        u32 GetNumAllocations() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total number of allocations which have been made
+        /// since the manager was created. Sampling this before and after
+        /// a section of work gives the number of allocations it made.
+        //----------------------------------------------------------------
+        u64 GetTotalAllocations() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total number of allocations which have overflowed
+        /// to the heap since the manager was created.
+        //----------------------------------------------------------------
+        u64 GetTotalOverflowAllocations() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of particles currently reserved from the
+        /// global particle budget.
+        //----------------------------------------------------------------
+        u32 GetNumLiveParticles() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The highest number of particles which have been
+        /// reserved from the global particle budget at once.
+        //----------------------------------------------------------------
+        u32 GetPeakLiveParticles() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The total number of particle emissions which have been
+        /// throttled because the global particle budget was exhausted.
+        //----------------------------------------------------------------
+        u32 GetNumThrottledParticles() const;
+        //----------------------------------------------------------------
+        /// Resets the peak arena usage and peak live particles to their
+        /// current values.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void ResetPeakStats();
+        //----------------------------------------------------------------
+        /// Allocates an array of default constructed elements from the
+        /// arena. The storage is returned to the arena when the array is
+        /// destroyed, which must happen before the manager is destroyed.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of elements.
+        ///
+        /// @return The new array.
+        //----------------------------------------------------------------
+        template <typename TType> dynamic_array<TType> AllocateArray(std::size_t in_size);
+        //----------------------------------------------------------------
+        /// Tries to reserve the given number of particles from the global
+        /// particle budget. Fewer particles may be reserved depending on
+        /// the priority of the effect and the number of live particles.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of particles to reserve.
+        /// @param The priority of the effect reserving the particles.
+        ///
+        /// @return The number of particles which were reserved.
+        //----------------------------------------------------------------
+        u32 ReserveParticles(u32 in_numParticles, ParticleEffect::Priority in_priority);
+        //----------------------------------------------------------------
+        /// Returns previously reserved particles to the global budget.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of particles to release.
+        //----------------------------------------------------------------
+        void ReleaseParticles(u32 in_numParticles);
+        //----------------------------------------------------------------
+        /// Destructor.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ~ParticleMemoryManager();
+    private:
+        //----------------------------------------------------------------
+        /// The header stored at the start of each allocation.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct AllocationHeader final
+        {
+            ParticleMemoryManager* m_owner = nullptr;
+            std::size_t m_numElements = 0;
+            std::size_t m_offset = 0;
+            std::size_t m_blockSize = 0;
+        };
+        //----------------------------------------------------------------
+        /// The link stored at the start of each free block in the arena.
+        /// Free blocks form a singly linked list ordered by address, so
+        /// tracking them requires no additional memory.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct FreeBlock final
+        {
+            std::size_t m_size = 0;
+            FreeBlock* m_next = nullptr;
+        };
+
+        //SIMD types used by particle storage, such as the billboard expansion batches, require 16 byte
+        //alignment, which is stricter than the alignment of std::max_align_t on some platforms.
+        static constexpr std::size_t k_alignment = (alignof(std::max_align_t) > 16) ? alignof(std::max_align_t) : 16;
+        static constexpr std::size_t k_headerSize = ((sizeof(AllocationHeader) + k_alignment - 1) / k_alignment) * k_alignment;
+
+        static_assert(sizeof(FreeBlock) <= k_alignment, "The smallest free block must be able to hold its link.");
+        //----------------------------------------------------------------
+        /// Allocates a block of the given size, falling back on the heap
+        /// if there is no space in the arena.
+        ///
+        /// @author agent
+        ///
+        /// @param The size of the block in bytes, including the header.
+        ///
+        /// @return The header at the start of the new block.
+        //----------------------------------------------------------------
+        AllocationHeader* Allocate(std::size_t in_size);
+        //----------------------------------------------------------------
+        /// Returns the block described by the given header to the arena,
+        /// or the heap if it overflowed.
+        ///
+        /// @author agent
+        ///
+        /// @param The header at the start of the block.
+        //----------------------------------------------------------------
+        void Deallocate(AllocationHeader* in_header);
+        //----------------------------------------------------------------
+        /// The deleter used by all arrays allocated from the manager.
+        /// This destroys the elements and returns the storage to the
+        /// manager which allocated it.
+        ///
+        /// @author agent
+        ///
+        /// @param The array.
+        //----------------------------------------------------------------
+        template <typename TType> static void DeleteArray(TType* in_array);
+
+        mutable std::mutex m_mutex;
+        std::size_t m_arenaSize;
+        u8* m_arena = nullptr;
+        FreeBlock* m_freeBlocks = nullptr;
+        u32 m_numAllocations = 0;
+        u64 m_totalAllocations = 0;
+        u64 m_totalOverflowAllocations = 0;
+        std::size_t m_arenaUsage = 0;
+        std::size_t m_peakArenaUsage = 0;
+        std::size_t m_overflowUsage = 0;
+
+        std::atomic<u32> m_particleBudget;
+        std::atomic<u32> m_numLiveParticles;
+        std::atomic<u32> m_peakLiveParticles;
+        std::atomic<u32> m_numThrottledParticles;
+    };
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    template <typename TType> dynamic_array<TType> ParticleMemoryManager::AllocateArray(std::size_t in_size)
+    {
+        static_assert(alignof(TType) <= k_alignment, "Particle storage cannot be over-aligned.");
+
+        if (in_size == 0)
+        {
+            return dynamic_array<TType>(0);
+        }
+
+        AllocationHeader* header = Allocate(k_headerSize + in_size * sizeof(TType));
+        header->m_numElements = in_size;
+
+        TType* elements = reinterpret_cast<TType*>(reinterpret_cast<u8*>(header) + k_headerSize);
+        for (std::size_t i = 0; i < in_size; ++i)
+        {
+            new (elements + i) TType;
+        }
+
+        return dynamic_array<TType>(in_size, elements, &ParticleMemoryManager::DeleteArray<TType>);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    template <typename TType> void ParticleMemoryManager::DeleteArray(TType* in_array)
+    {
+        AllocationHeader* header = reinterpret_cast<AllocationHeader*>(reinterpret_cast<u8*>(in_array) - k_headerSize);
+        for (std::size_t i = 0; i < header->m_numElements; ++i)
+        {
+            in_array[i].~TType();
+        }
+
+        header->m_owner->Deallocate(header);
+    }
+}
+
+#endif
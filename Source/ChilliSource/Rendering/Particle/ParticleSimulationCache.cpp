@@ -0,0 +1,408 @@
+//
+//  ParticleSimulationCache.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/ColourUtils.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Math/MathUtils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        //"CSPC" as a little endian integer.
+        constexpr u32 k_cacheMagic = 0x43505343;
+        constexpr u32 k_cacheVersion = 1;
+        constexpr f32 k_maxQuantisedValue = 65535.0f;
+        const f32 k_twoPi = 2.0f * MathUtils::k_pi;
+
+        //----------------------------------------------------------------
+        /// The header at the start of the cache data.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct CacheHeader final
+        {
+            u32 m_magic;
+            u32 m_version;
+            f32 m_frameRate;
+            u32 m_numFrames;
+            u32 m_maxParticles;
+        };
+        //----------------------------------------------------------------
+        /// The header for each frame. These directly follow the cache
+        /// header.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct FrameHeader final
+        {
+            f32 m_min[3];
+            f32 m_max[3];
+            f32 m_scaleRange;
+            u32 m_numParticles;
+            u32 m_firstParticle;
+        };
+        //----------------------------------------------------------------
+        /// The quantised state of a single particle in a single frame.
+        /// The particles for all frames directly follow the frame headers.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct ParticleRecord final
+        {
+            u16 m_slotIndex;
+            u16 m_slotGeneration;
+            u16 m_position[3];
+            u16 m_rotation;
+            u16 m_scale[2];
+            u8 m_colour[4];
+        };
+
+        static_assert(sizeof(CacheHeader) == 20, "Cache header must be tightly packed.");
+        static_assert(sizeof(FrameHeader) == 36, "Frame header must be tightly packed.");
+        static_assert(sizeof(ParticleRecord) == 20, "Particle record must be tightly packed.");
+
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The value.
+        /// @param The minimum of the quantisation range.
+        /// @param The size of the quantisation range.
+        ///
+        /// @return The value quantised to 16 bits within the range.
+        //----------------------------------------------------------------
+        u16 Quantise(f32 in_value, f32 in_min, f32 in_range)
+        {
+            if (in_range <= 0.0f)
+            {
+                return 0;
+            }
+
+            return u16(MathUtils::Clamp((in_value - in_min) / in_range, 0.0f, 1.0f) * k_maxQuantisedValue + 0.5f);
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The quantised value.
+        /// @param The minimum of the quantisation range.
+        /// @param The size of the quantisation range.
+        ///
+        /// @return The unquantised value.
+        //----------------------------------------------------------------
+        f32 Dequantise(u16 in_value, f32 in_min, f32 in_range)
+        {
+            return in_min + in_range * (f32(in_value) / k_maxQuantisedValue);
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The cache data.
+        ///
+        /// @return The cache header.
+        //----------------------------------------------------------------
+        const CacheHeader* GetCacheHeader(const u8* in_data)
+        {
+            return reinterpret_cast<const CacheHeader*>(in_data);
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The cache data.
+        /// @param The frame index.
+        ///
+        /// @return The header for the given frame.
+        //----------------------------------------------------------------
+        const FrameHeader* GetFrameHeader(const u8* in_data, u32 in_frameIndex)
+        {
+            CS_ASSERT(in_frameIndex < GetCacheHeader(in_data)->m_numFrames, "Frame index out of bounds.");
+
+            return reinterpret_cast<const FrameHeader*>(in_data + sizeof(CacheHeader)) + in_frameIndex;
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The cache data.
+        ///
+        /// @return The first particle record.
+        //----------------------------------------------------------------
+        const ParticleRecord* GetParticleRecords(const u8* in_data)
+        {
+            return reinterpret_cast<const ParticleRecord*>(in_data + sizeof(CacheHeader) + sizeof(FrameHeader) * GetCacheHeader(in_data)->m_numFrames);
+        }
+    }
+
+    CS_DEFINE_NAMEDTYPE(ParticleSimulationCache);
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    ParticleSimulationCache::Recorder::Recorder(f32 in_frameRate, u32 in_maxParticles)
+        : m_frameRate(in_frameRate), m_maxParticles(in_maxParticles)
+    {
+        CS_ASSERT(m_frameRate > 0.0f, "Simulation cache frame rate must be greater than zero.");
+        CS_ASSERT(m_maxParticles <= 65536, "Simulation caches cannot contain more than 65536 particles.");
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void ParticleSimulationCache::Recorder::AddFrame(u32 in_numParticles, const ConcurrentParticleData::Particle* in_particles, const AABB& in_aabb)
+    {
+        CS_ASSERT(in_numParticles <= m_maxParticles, "Too many particles in simulation cache frame.");
+
+        const Vector3 min = in_aabb.GetOrigin() - 0.5f * in_aabb.GetSize();
+        const Vector3 size = in_aabb.GetSize();
+
+        f32 scaleRange = 0.0f;
+        for (u32 i = 0; i < in_numParticles; ++i)
+        {
+            scaleRange = std::max(scaleRange, std::max(std::abs(in_particles[i].m_scale.x), std::abs(in_particles[i].m_scale.y)));
+        }
+
+        FrameHeader frameHeader;
+        frameHeader.m_min[0] = min.x;
+        frameHeader.m_min[1] = min.y;
+        frameHeader.m_min[2] = min.z;
+        frameHeader.m_max[0] = min.x + size.x;
+        frameHeader.m_max[1] = min.y + size.y;
+        frameHeader.m_max[2] = min.z + size.z;
+        frameHeader.m_scaleRange = scaleRange;
+        frameHeader.m_numParticles = in_numParticles;
+        frameHeader.m_firstParticle = u32(m_particleData.size() / sizeof(ParticleRecord));
+
+        const u8* frameHeaderBytes = reinterpret_cast<const u8*>(&frameHeader);
+        m_frameData.insert(m_frameData.end(), frameHeaderBytes, frameHeaderBytes + sizeof(FrameHeader));
+
+        const u32 firstByte = u32(m_particleData.size());
+        m_particleData.resize(firstByte + in_numParticles * sizeof(ParticleRecord));
+        ParticleRecord* records = reinterpret_cast<ParticleRecord*>(m_particleData.data() + firstByte);
+
+        for (u32 i = 0; i < in_numParticles; ++i)
+        {
+            const ConcurrentParticleData::Particle& particle = in_particles[i];
+            ParticleRecord& record = records[i];
+
+            CS_ASSERT(particle.m_slotIndex < 65536, "Particle slot index cannot be stored in a simulation cache.");
+
+            record.m_slotIndex = u16(particle.m_slotIndex);
+            record.m_slotGeneration = u16(particle.m_slotGeneration);
+            record.m_position[0] = Quantise(particle.m_position.x, min.x, size.x);
+            record.m_position[1] = Quantise(particle.m_position.y, min.y, size.y);
+            record.m_position[2] = Quantise(particle.m_position.z, min.z, size.z);
+
+            f32 rotation = std::fmod(particle.m_rotation, k_twoPi);
+            if (rotation < 0.0f)
+            {
+                rotation += k_twoPi;
+            }
+            record.m_rotation = Quantise(rotation, 0.0f, k_twoPi);
+
+            record.m_scale[0] = Quantise(particle.m_scale.x, -scaleRange, 2.0f * scaleRange);
+            record.m_scale[1] = Quantise(particle.m_scale.y, -scaleRange, 2.0f * scaleRange);
+
+            const ByteColour colour = ColourUtils::ColourToByteColour(particle.m_colour);
+            record.m_colour[0] = colour.r;
+            record.m_colour[1] = colour.g;
+            record.m_colour[2] = colour.b;
+            record.m_colour[3] = colour.a;
+        }
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void ParticleSimulationCache::Recorder::Build(ParticleSimulationCache* out_cache)
+    {
+        CS_ASSERT(out_cache != nullptr, "Cannot build a null simulation cache.");
+
+        CacheHeader cacheHeader;
+        cacheHeader.m_magic = k_cacheMagic;
+        cacheHeader.m_version = k_cacheVersion;
+        cacheHeader.m_frameRate = m_frameRate;
+        cacheHeader.m_numFrames = u32(m_frameData.size() / sizeof(FrameHeader));
+        cacheHeader.m_maxParticles = m_maxParticles;
+
+        const u32 dataSize = u32(sizeof(CacheHeader) + m_frameData.size() + m_particleData.size());
+        std::unique_ptr<u8[]> data(new u8[dataSize]);
+        std::memcpy(data.get(), &cacheHeader, sizeof(CacheHeader));
+        std::memcpy(data.get() + sizeof(CacheHeader), m_frameData.data(), m_frameData.size());
+        std::memcpy(data.get() + sizeof(CacheHeader) + m_frameData.size(), m_particleData.data(), m_particleData.size());
+
+        m_frameData.clear();
+        m_particleData.clear();
+
+        out_cache->Build(std::unique_ptr<const u8[]>(data.release()), dataSize);
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    ParticleSimulationCacheUPtr ParticleSimulationCache::Create()
+    {
+        return ParticleSimulationCacheUPtr(new ParticleSimulationCache());
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    bool ParticleSimulationCache::IsA(InterfaceIDType in_interfaceId) const
+    {
+        return (ParticleSimulationCache::InterfaceID == in_interfaceId);
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void ParticleSimulationCache::Build(std::unique_ptr<const u8[]> in_data, u32 in_dataSize)
+    {
+        CS_ASSERT(in_data != nullptr, "Cannot build simulation cache with null data.");
+        CS_ASSERT(in_dataSize >= sizeof(CacheHeader), "Simulation cache data is too small.");
+
+#ifdef CS_ENABLE_DEBUG
+        const CacheHeader* cacheHeader = GetCacheHeader(in_data.get());
+        CS_ASSERT(cacheHeader->m_magic == k_cacheMagic, "Data is not a particle simulation cache.");
+        CS_ASSERT(cacheHeader->m_version == k_cacheVersion, "Unsupported particle simulation cache version.");
+        CS_ASSERT(cacheHeader->m_frameRate > 0.0f, "Simulation cache frame rate must be greater than zero.");
+        CS_ASSERT(in_dataSize >= sizeof(CacheHeader) + sizeof(FrameHeader) * cacheHeader->m_numFrames, "Simulation cache data is too small.");
+
+        if (cacheHeader->m_numFrames > 0)
+        {
+            const FrameHeader* lastFrame = GetFrameHeader(in_data.get(), cacheHeader->m_numFrames - 1);
+            CS_ASSERT(in_dataSize == sizeof(CacheHeader) + sizeof(FrameHeader) * cacheHeader->m_numFrames + sizeof(ParticleRecord) * (lastFrame->m_firstParticle + lastFrame->m_numParticles),
+                "Simulation cache data size doesn't match the contents.");
+        }
+#endif
+
+        m_data = std::move(in_data);
+        m_dataSize = in_dataSize;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    const u8* ParticleSimulationCache::GetData() const
+    {
+        return m_data.get();
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 ParticleSimulationCache::GetDataSize() const
+    {
+        return m_dataSize;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    f32 ParticleSimulationCache::GetFrameRate() const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        return GetCacheHeader(m_data.get())->m_frameRate;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 ParticleSimulationCache::GetNumFrames() const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        return GetCacheHeader(m_data.get())->m_numFrames;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    f32 ParticleSimulationCache::GetDuration() const
+    {
+        return f32(GetNumFrames()) / GetFrameRate();
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 ParticleSimulationCache::GetMaxParticles() const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        return GetCacheHeader(m_data.get())->m_maxParticles;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u32 ParticleSimulationCache::GetNumParticles(u32 in_frameIndex) const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        return GetFrameHeader(m_data.get(), in_frameIndex)->m_numParticles;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    AABB ParticleSimulationCache::GetAABB(u32 in_frameIndex) const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        const FrameHeader* frameHeader = GetFrameHeader(m_data.get(), in_frameIndex);
+        const Vector3 min(frameHeader->m_min[0], frameHeader->m_min[1], frameHeader->m_min[2]);
+        const Vector3 max(frameHeader->m_max[0], frameHeader->m_max[1], frameHeader->m_max[2]);
+        const Vector3 size = max - min;
+
+        return AABB(min + 0.5f * size, size);
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    Sphere ParticleSimulationCache::GetBoundingSphere(u32 in_frameIndex) const
+    {
+        const AABB aabb = GetAABB(in_frameIndex);
+
+        return Sphere(aabb.GetOrigin(), aabb.GetSize().Length() * 0.5f);
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void ParticleSimulationCache::DecodeFrame(u32 in_frameIndex, ConcurrentParticleData::Particle* out_particles) const
+    {
+        CS_ASSERT(m_data != nullptr, "Simulation cache has not been built.");
+
+        const FrameHeader* frameHeader = GetFrameHeader(m_data.get(), in_frameIndex);
+        const ParticleRecord* records = GetParticleRecords(m_data.get()) + frameHeader->m_firstParticle;
+
+        const Vector3 min(frameHeader->m_min[0], frameHeader->m_min[1], frameHeader->m_min[2]);
+        const Vector3 size = Vector3(frameHeader->m_max[0], frameHeader->m_max[1], frameHeader->m_max[2]) - min;
+        const f32 scaleRange = frameHeader->m_scaleRange;
+
+        for (u32 i = 0; i < frameHeader->m_numParticles; ++i)
+        {
+            const ParticleRecord& record = records[i];
+            ConcurrentParticleData::Particle& particle = out_particles[i];
+
+            particle.m_slotIndex = record.m_slotIndex;
+            particle.m_slotGeneration = record.m_slotGeneration;
+            particle.m_position.x = Dequantise(record.m_position[0], min.x, size.x);
+            particle.m_position.y = Dequantise(record.m_position[1], min.y, size.y);
+            particle.m_position.z = Dequantise(record.m_position[2], min.z, size.z);
+            particle.m_previousPosition = particle.m_position;
+            particle.m_rotation = Dequantise(record.m_rotation, 0.0f, k_twoPi);
+            particle.m_scale.x = Dequantise(record.m_scale[0], -scaleRange, 2.0f * scaleRange);
+            particle.m_scale.y = Dequantise(record.m_scale[1], -scaleRange, 2.0f * scaleRange);
+            particle.m_colour = ColourUtils::ByteColourToColour(record.m_colour[0], record.m_colour[1], record.m_colour[2], record.m_colour[3]);
+        }
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    bool ParticleSimulationCache::Save(StorageLocation in_storageLocation, const std::string& in_filePath) const
+    {
+        CS_ASSERT(m_data != nullptr, "Cannot save a simulation cache which has not been built.");
+
+        return Application::Get()->GetFileSystem()->WriteFile(in_storageLocation, in_filePath, reinterpret_cast<const s8*>(m_data.get()), m_dataSize);
+    }
+}
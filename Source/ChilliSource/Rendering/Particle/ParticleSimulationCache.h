@@ -0,0 +1,238 @@
+//
+//  ParticleSimulationCache.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESIMULATIONCACHE_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESIMULATIONCACHE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Resource/Resource.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// A baked, pre-simulated particle effect. This contains the state of
+    /// each particle for every frame of the simulation, quantised to keep
+    /// the cache small, which can be played back by a Particle Effect
+    /// Component instead of simulating the effect. This trades memory for
+    /// CPU time.
+    ///
+    /// The cache is stored as a single contiguous block of data containing
+    /// no pointers, so the data in a cache file can be used directly as it
+    /// is read or mapped into memory. Positions are quantised to 16 bits
+    /// relative to the bounds of each frame, rotation and scale to 16 bits,
+    /// and colour to 8 bits per channel.
+    ///
+    /// Caches are typically created using ParticleSystem::BakeSimulationCache()
+    /// or loaded from a csparticlecache file.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleSimulationCache final : public Resource
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(ParticleSimulationCache);
+        //----------------------------------------------------------------
+        /// Builds up the cache data from the state of the particles in
+        /// each frame of a simulation. Once all frames have been added
+        /// the cache data can be built.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        class Recorder final
+        {
+        public:
+            //------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author agent
+            ///
+            /// @param The number of frames per second of the simulation.
+            /// @param The max number of particles in the simulation. This
+            /// cannot exceed 65536.
+            //------------------------------------------------------------
+            Recorder(f32 in_frameRate, u32 in_maxParticles);
+            //------------------------------------------------------------
+            /// Quantises and stores the state of the particles for the
+            /// next frame.
+            ///
+            /// @author agent
+            ///
+            /// @param The number of active particles.
+            /// @param The active particles.
+            /// @param The bounds of the particles.
+            //------------------------------------------------------------
+            void AddFrame(u32 in_numParticles, const ConcurrentParticleData::Particle* in_particles, const AABB& in_aabb);
+            //------------------------------------------------------------
+            /// Builds the given cache from the recorded frames. The
+            /// recorder will be empty afterwards.
+            ///
+            /// @author agent
+            ///
+            /// @param [Out] The cache to build.
+            //------------------------------------------------------------
+            void Build(ParticleSimulationCache* out_cache);
+
+        private:
+            f32 m_frameRate;
+            u32 m_maxParticles;
+            std::vector<u8> m_frameData;
+            std::vector<u8> m_particleData;
+        };
+        //----------------------------------------------------------------
+        /// Allows querying of whether or not this implements the interface
+        /// described by the given Id.
+        ///
+        /// @author agent
+        ///
+        /// @param The interface Id.
+        ///
+        /// @return Whether or not the interface is implemented.
+        //----------------------------------------------------------------
+        bool IsA(InterfaceIDType in_interfaceId) const override;
+        //----------------------------------------------------------------
+        /// Builds the cache from the given cache data. The data is used
+        /// in place, rather than being unpacked. This will assert if the
+        /// data is not valid cache data.
+        ///
+        /// @author agent
+        ///
+        /// @param The cache data.
+        /// @param The size of the cache data.
+        //----------------------------------------------------------------
+        void Build(std::unique_ptr<const u8[]> in_data, u32 in_dataSize);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The cache data. This can be written to a file and
+        /// loaded again later.
+        //----------------------------------------------------------------
+        const u8* GetData() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The size of the cache data.
+        //----------------------------------------------------------------
+        u32 GetDataSize() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of frames per second.
+        //----------------------------------------------------------------
+        f32 GetFrameRate() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of frames in the cache.
+        //----------------------------------------------------------------
+        u32 GetNumFrames() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The duration of the cached simulation.
+        //----------------------------------------------------------------
+        f32 GetDuration() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The max number of particles in any frame. This must not
+        /// exceed the max particles of an effect played with the cache.
+        //----------------------------------------------------------------
+        u32 GetMaxParticles() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The frame index.
+        ///
+        /// @return The number of active particles in the frame.
+        //----------------------------------------------------------------
+        u32 GetNumParticles(u32 in_frameIndex) const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The frame index.
+        ///
+        /// @return The bounds of the particles in the frame.
+        //----------------------------------------------------------------
+        AABB GetAABB(u32 in_frameIndex) const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The frame index.
+        ///
+        /// @return The bounding sphere of the particles in the frame.
+        //----------------------------------------------------------------
+        Sphere GetBoundingSphere(u32 in_frameIndex) const;
+        //----------------------------------------------------------------
+        /// Unpacks the particles in the given frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The frame index.
+        /// @param [Out] The particles. This must be large enough to hold
+        /// the number of particles in the frame.
+        //----------------------------------------------------------------
+        void DecodeFrame(u32 in_frameIndex, ConcurrentParticleData::Particle* out_particles) const;
+        //----------------------------------------------------------------
+        /// Writes the cache data to a csparticlecache file.
+        ///
+        /// @author agent
+        ///
+        /// @param The storage location.
+        /// @param The file path.
+        ///
+        /// @return Whether or not the file was written successfully.
+        //----------------------------------------------------------------
+        bool Save(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+    private:
+        friend class ResourcePool;
+        //----------------------------------------------------------------
+        /// Factory method to create an new instance of an empty cache
+        /// resource. Only called by the resource pool.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        static ParticleSimulationCacheUPtr Create();
+        //----------------------------------------------------------------
+        /// Private constructor to ensure that the factory method is used
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ParticleSimulationCache() = default;
+
+        std::unique_ptr<const u8[]> m_data;
+        u32 m_dataSize = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+//
+//  ParticleStats.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleStats.h>
+
+#include <chrono>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param A duration in nanoseconds.
+        ///
+        /// @return The duration in milliseconds.
+        //----------------------------------------------------------------
+        f32 ToMilliseconds(u64 in_duration)
+        {
+            return f32(f64(in_duration) / 1000000.0);
+        }
+    }
+
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleStats::ParticleStats()
+        : m_numEmittedParticles(0), m_numDroppedEmissions(0), m_numUpdates(0), m_numSkippedUpdates(0), m_numUpdateTasks(0), m_updateTaskTime(0), m_maxUpdateTaskTime(0), m_commitTime(0)
+    {
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u64 ParticleStats::GetTimestamp()
+    {
+        return u64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::AddEmittedParticles(u32 in_numParticles)
+    {
+        m_numEmittedParticles.fetch_add(in_numParticles, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::AddDroppedEmissions(u32 in_numEmissions)
+    {
+        m_numDroppedEmissions.fetch_add(in_numEmissions, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::AddSkippedUpdate()
+    {
+        m_numSkippedUpdates.fetch_add(1, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::AddUpdateTask(u64 in_duration)
+    {
+        m_numUpdateTasks.fetch_add(1, std::memory_order_relaxed);
+        m_updateTaskTime.fetch_add(in_duration, std::memory_order_relaxed);
+
+        u64 maxDuration = m_maxUpdateTaskTime.load(std::memory_order_relaxed);
+        while (in_duration > maxDuration && m_maxUpdateTaskTime.compare_exchange_weak(maxDuration, in_duration, std::memory_order_relaxed) == false)
+        {
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::AddCommit(u64 in_duration)
+    {
+        m_numUpdates.fetch_add(1, std::memory_order_relaxed);
+        m_commitTime.fetch_add(in_duration, std::memory_order_relaxed);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleStats::EndFrame(u32 in_numActiveParticles)
+    {
+        Frame frame;
+        frame.m_numActiveParticles = in_numActiveParticles;
+        frame.m_numEmittedParticles = m_numEmittedParticles.exchange(0, std::memory_order_relaxed);
+        frame.m_numDroppedEmissions = m_numDroppedEmissions.exchange(0, std::memory_order_relaxed);
+        frame.m_numUpdates = m_numUpdates.exchange(0, std::memory_order_relaxed);
+        frame.m_numSkippedUpdates = m_numSkippedUpdates.exchange(0, std::memory_order_relaxed);
+        frame.m_numUpdateTasks = m_numUpdateTasks.exchange(0, std::memory_order_relaxed);
+        frame.m_updateTaskTime = ToMilliseconds(m_updateTaskTime.exchange(0, std::memory_order_relaxed));
+        frame.m_maxUpdateTaskTime = ToMilliseconds(m_maxUpdateTaskTime.exchange(0, std::memory_order_relaxed));
+        frame.m_commitTime = ToMilliseconds(m_commitTime.exchange(0, std::memory_order_relaxed));
+
+        std::unique_lock<std::mutex> lock(m_lastFrameMutex);
+        m_lastFrame = frame;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleStats::Frame ParticleStats::GetLastFrame() const
+    {
+        std::unique_lock<std::mutex> lock(m_lastFrameMutex);
+        return m_lastFrame;
+    }
+}
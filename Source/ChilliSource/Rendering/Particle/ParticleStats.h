@@ -0,0 +1,162 @@
+//
+//  ParticleStats.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESTATS_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESTATS_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace ChilliSource
+{
+    //-----------------------------------------------------------------------
+    /// Accumulates per-frame statistics describing the work performed by the
+    /// particle system. Counters are added to from both the main thread and
+    /// the particle update tasks, and are gathered into a snapshot of the
+    /// previous frame each time EndFrame() is called.
+    ///
+    /// Work is attributed to the frame in which it finished, so updates
+    /// which span a frame boundary are counted in the later frame.
+    ///
+    /// This is thread-safe.
+    ///
+    /// @author agent
+    //-----------------------------------------------------------------------
+    class ParticleStats final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleStats);
+        //----------------------------------------------------------------
+        /// The statistics for a single frame.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct Frame final
+        {
+            u32 m_numActiveParticles = 0;
+            u32 m_numEmittedParticles = 0;
+            u32 m_numDroppedEmissions = 0;
+            u32 m_numUpdates = 0;
+            u32 m_numSkippedUpdates = 0;
+            u32 m_numUpdateTasks = 0;
+            f32 m_updateTaskTime = 0.0f;
+            f32 m_maxUpdateTaskTime = 0.0f;
+            f32 m_commitTime = 0.0f;
+        };
+        //----------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ParticleStats();
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return A timestamp in nanoseconds from a monotonic clock, for
+        /// use when timing sections of the particle update.
+        //----------------------------------------------------------------
+        static u64 GetTimestamp();
+        //----------------------------------------------------------------
+        /// Adds newly emitted particles to the current frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of particles which were emitted.
+        //----------------------------------------------------------------
+        void AddEmittedParticles(u32 in_numParticles);
+        //----------------------------------------------------------------
+        /// Adds emissions which were dropped because the particle array
+        /// of an effect was full to the current frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of dropped emissions.
+        //----------------------------------------------------------------
+        void AddDroppedEmissions(u32 in_numEmissions);
+        //----------------------------------------------------------------
+        /// Adds a particle effect update which was skipped because the
+        /// previous update of the effect had not yet been committed. The
+        /// time for skipped updates is accumulated and simulated in the
+        /// next update.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void AddSkippedUpdate();
+        //----------------------------------------------------------------
+        /// Adds a particle update task to the current frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The duration of the task in nanoseconds.
+        //----------------------------------------------------------------
+        void AddUpdateTask(u64 in_duration);
+        //----------------------------------------------------------------
+        /// Adds a particle effect update which has committed its particle
+        /// data to the current frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The time taken to commit the particle data in
+        /// nanoseconds.
+        //----------------------------------------------------------------
+        void AddCommit(u64 in_duration);
+        //----------------------------------------------------------------
+        /// Finishes the current frame, storing its statistics so they can
+        /// be queried with GetLastFrame(), and starts a new frame.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of active particles at the end of the frame.
+        //----------------------------------------------------------------
+        void EndFrame(u32 in_numActiveParticles);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The statistics for the last finished frame. All times
+        /// are in milliseconds. The update task time is the sum of all
+        /// update tasks, which may have run concurrently.
+        //----------------------------------------------------------------
+        Frame GetLastFrame() const;
+    private:
+        std::atomic<u32> m_numEmittedParticles;
+        std::atomic<u32> m_numDroppedEmissions;
+        std::atomic<u32> m_numUpdates;
+        std::atomic<u32> m_numSkippedUpdates;
+        std::atomic<u32> m_numUpdateTasks;
+        std::atomic<u64> m_updateTaskTime;
+        std::atomic<u64> m_maxUpdateTaskTime;
+        std::atomic<u64> m_commitTime;
+
+        mutable std::mutex m_lastFrameMutex;
+        Frame m_lastFrame;
+    };
+}
+
+#endif
@@ -0,0 +1,995 @@
+//
+//  ParticleSystem.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleSystem.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleIntegration.h>
+#include <ChilliSource/Rendering/Particle/ParticleMemoryManager.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulationCache.h>
+#include <ChilliSource/Rendering/Particle/ParticleStats.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Drawable/ParticleVertexBuilder.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        //The estimated cost of updating an effect, regardless of particle count, measured in particles.
+        constexpr u32 k_effectUpdateCost = 32;
+        //The number of particles above which an effect will be updated across multiple tasks.
+        constexpr u32 k_parallelUpdateThreshold = 8192;
+        //The minimum number of particles processed by a single task in a parallel update. This is a multiple of the integration batch size.
+        constexpr u32 k_minParallelChunkSize = 2048;
+        //The time step used when prewarming an effect. This is deliberately coarse as prewarmed particles are never seen mid simulation.
+        constexpr f32 k_prewarmTimeStep = 0.1f;
+
+        //----------------------------------------------------------------
+        /// The state shared between the tasks of a single parallel
+        /// particle effect update.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct ParallelUpdate final
+        {
+            ParticleSystem::UpdateDesc m_desc;
+            std::function<void()> m_completionDelegate;
+            f32 m_effectProgress = 0.0f;
+            f32 m_stepDeltaTime = 0.0f;
+            u32 m_numSteps = 1;
+            u32 m_stepIndex = 0;
+            u32 m_numChunks = 0;
+            std::vector<Vector3> m_chunkMins;
+            std::vector<Vector3> m_chunkMaxs;
+        };
+        //----------------------------------------------------------------
+        /// Expands the given bounds to contain the particles in the given
+        /// range.
+        ///
+        /// @author agent
+        ///
+        /// @param The array of particles.
+        /// @param The index of the first particle.
+        /// @param The index after the last particle.
+        /// @param [In/Out] The minimum of the bounds.
+        /// @param [In/Out] The maximum of the bounds.
+        //----------------------------------------------------------------
+        void ExpandBounds(const ParticleArray* in_particleArray, u32 in_start, u32 in_end, Vector3& inout_min, Vector3& inout_max)
+        {
+            const dynamic_array<Vector3>& positions = in_particleArray->GetPositions();
+            for (u32 i = in_start; i < in_end; ++i)
+            {
+                const Vector3& position = positions[i];
+                if (position.x < inout_min.x)
+                    inout_min.x = position.x;
+                if (position.y < inout_min.y)
+                    inout_min.y = position.y;
+                if (position.z < inout_min.z)
+                    inout_min.z = position.z;
+
+                if (position.x > inout_max.x)
+                    inout_max.x = position.x;
+                if (position.y > inout_max.y)
+                    inout_max.y = position.y;
+                if (position.z > inout_max.z)
+                    inout_max.z = position.z;
+            }
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The minimum of an empty set of bounds.
+        //----------------------------------------------------------------
+        Vector3 GetEmptyBoundsMin()
+        {
+            return Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The maximum of an empty set of bounds.
+        //----------------------------------------------------------------
+        Vector3 GetEmptyBoundsMax()
+        {
+            return Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The particle update description.
+        ///
+        /// @return The number of steps the delta time of the update is
+        /// simulated in. This is always one if no time step is given.
+        //----------------------------------------------------------------
+        u32 CalculateNumSteps(const ParticleSystem::UpdateDesc& in_desc)
+        {
+            if (in_desc.m_timeStep <= 0.0f)
+            {
+                return 1;
+            }
+
+            return std::max(u32(in_desc.m_deltaTime / in_desc.m_timeStep + 0.5f), 1u);
+        }
+        //----------------------------------------------------------------
+        /// Removes any particles which have been deactivated from the
+        /// particle array. The last active particle is moved into the
+        /// place of each removed particle, and the affectors are informed
+        /// so they can move their per-particle data.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle array.
+        /// @param The particle affectors.
+        //----------------------------------------------------------------
+        void RemoveInactiveParticles(ParticleArray* inout_particleArray, const std::vector<ParticleAffectorSPtr>& in_affectors)
+        {
+            const dynamic_array<bool>& activeFlags = inout_particleArray->GetActiveFlags();
+
+            u32 index = 0;
+            while (index < inout_particleArray->GetNumActiveParticles())
+            {
+                if (activeFlags[index] == true)
+                {
+                    ++index;
+                }
+                else
+                {
+                    u32 lastIndex = inout_particleArray->GetNumActiveParticles() - 1;
+                    inout_particleArray->RemoveParticle(index);
+
+                    if (index != lastIndex)
+                    {
+                        for (auto& affector : in_affectors)
+                        {
+                            affector->MoveParticle(lastIndex, index);
+                        }
+                    }
+                }
+            }
+
+            inout_particleArray->ReleaseUnusedParticles();
+        }
+        //----------------------------------------------------------------
+        /// Emits any new particles and initialises them in each affector
+        /// and the vertex builder.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle update description.
+        /// @param The playback time to emit up to.
+        /// @param The normalised playback progress of the effect.
+        /// @param Whether or not to interpolate the emission position
+        /// from the previous emission.
+        //----------------------------------------------------------------
+        void Emit(const ParticleSystem::UpdateDesc& in_desc, f32 in_playbackTime, f32 in_effectProgress, bool in_interpolateEmission)
+        {
+            if (in_desc.m_particleEmitter == nullptr)
+            {
+                return;
+            }
+
+            const u32 numDroppedEmissions = in_desc.m_particleEmitter->GetNumDroppedEmissions();
+
+            std::vector<u32> newIndices = in_desc.m_particleEmitter->TryEmit(in_playbackTime, in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation, in_interpolateEmission,
+                in_desc.m_emissionRateScale, in_desc.m_maxParticlesScale);
+
+            if (in_desc.m_stats != nullptr)
+            {
+                in_desc.m_stats->AddEmittedParticles(u32(newIndices.size()));
+                in_desc.m_stats->AddDroppedEmissions(in_desc.m_particleEmitter->GetNumDroppedEmissions() - numDroppedEmissions);
+            }
+
+            //Initialise any new particles in each affector.
+            for (u32 newIndex : newIndices)
+            {
+                for (auto& affector : in_desc.m_particleAffectors)
+                {
+                    affector->ActivateParticle(newIndex, in_effectProgress);
+                }
+
+                if (in_desc.m_vertexBuilder != nullptr)
+                {
+                    in_desc.m_vertexBuilder->ActivateParticle(in_desc.m_particleArray.get(), newIndex);
+                }
+            }
+        }
+        //----------------------------------------------------------------
+        /// Simulates the effect for the prewarm duration using coarse fixed
+        /// time steps, finishing at the playback time at the start of the
+        /// update. The bounds are not calculated and nothing is committed
+        /// until the prewarm has finished, so the only cost is the
+        /// simulation itself.
+        ///
+        /// Non-looping effects are never simulated from before their start,
+        /// and stop emitting once their duration has elapsed.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle update description.
+        //----------------------------------------------------------------
+        void Prewarm(const ParticleSystem::UpdateDesc& in_desc)
+        {
+            const f32 duration = in_desc.m_particleEffect->GetDuration();
+            const f32 endTime = in_desc.m_playbackTime - in_desc.m_deltaTime;
+
+            f32 playbackTime = 0.0f;
+            f32 remainingTime = in_desc.m_prewarmDuration;
+            if (in_desc.m_looping == true)
+            {
+                playbackTime = std::fmod(endTime - remainingTime, duration);
+                if (playbackTime < 0.0f)
+                {
+                    playbackTime += duration;
+                }
+            }
+            else
+            {
+                playbackTime = std::max(endTime - remainingTime, 0.0f);
+                remainingTime = std::max(endTime - playbackTime, 0.0f);
+            }
+
+            bool interpolateEmission = false;
+            while (remainingTime > 0.0f)
+            {
+                const f32 deltaTime = std::min(k_prewarmTimeStep, remainingTime);
+                remainingTime -= deltaTime;
+
+                const bool wasFinished = (in_desc.m_looping == false && playbackTime >= duration);
+                playbackTime += deltaTime;
+                if (in_desc.m_looping == true)
+                {
+                    while (playbackTime >= duration)
+                    {
+                        playbackTime -= duration;
+                    }
+                }
+                else
+                {
+                    playbackTime = std::min(playbackTime, duration);
+                }
+
+                ParticleIntegration::Integrate(in_desc.m_particleArray.get(), deltaTime);
+                RemoveInactiveParticles(in_desc.m_particleArray.get(), in_desc.m_particleAffectors);
+
+                const f32 effectProgress = playbackTime / duration;
+                const u32 numParticles = in_desc.m_particleArray->GetNumActiveParticles();
+                for (auto& affector : in_desc.m_particleAffectors)
+                {
+                    affector->AffectParticles(deltaTime, effectProgress, 0, numParticles);
+                }
+
+                if (wasFinished == false)
+                {
+                    Emit(in_desc, playbackTime, effectProgress, interpolateEmission);
+                    interpolateEmission = true;
+                }
+            }
+        }
+        //----------------------------------------------------------------
+        /// Emits any new particles and initialises them in each affector,
+        /// then calculates the bounding shapes of the effect and commits
+        /// the particles to the concurrent particle data. This must be
+        /// performed serially.
+        ///
+        /// If the effect uses predicted bounds, the given bounds are
+        /// ignored and the predicted bounds are committed instead.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle update description.
+        /// @param The normalised playback progress of the effect.
+        /// @param The minimum of the bounds of the existing particles.
+        /// @param The maximum of the bounds of the existing particles.
+        //----------------------------------------------------------------
+        void EmitAndCommit(const ParticleSystem::UpdateDesc& in_desc, f32 in_effectProgress, Vector3 in_min, Vector3 in_max)
+        {
+            const u32 numExistingParticles = in_desc.m_particleArray->GetNumActiveParticles();
+
+            Emit(in_desc, in_desc.m_playbackTime, in_effectProgress, in_desc.m_interpolateEmission);
+
+            const u32 numParticles = in_desc.m_particleArray->GetNumActiveParticles();
+            if (in_desc.m_particleEffect->UsesPredictedBounds() == true)
+            {
+                const f32 extent = in_desc.m_particleEffect->GetPredictedBoundsExtent();
+                in_min = Vector3(-extent, -extent, -extent);
+                in_max = Vector3(extent, extent, extent);
+            }
+            else
+            {
+                //new particles are always added at the end of the array so only they need to be added to the bounds.
+                ExpandBounds(in_desc.m_particleArray.get(), numExistingParticles, numParticles, in_min, in_max);
+            }
+
+            if (numParticles == 0)
+            {
+                in_min = Vector3::k_zero;
+                in_max = Vector3::k_zero;
+            }
+
+            Vector3 size = in_max - in_min;
+            Vector3 centre = in_min + 0.5f * size;
+
+            //build the camera independent vertex data here rather than on the render thread, if requested.
+            if (in_desc.m_vertexBuilder != nullptr)
+            {
+                in_desc.m_vertexBuilder->BuildVertexData(in_desc.m_particleArray.get(), in_desc.m_entityPosition, in_desc.m_entityScale, in_desc.m_entityOrientation,
+                    in_desc.m_concurrentParticleData->GetUncommittedVertexData());
+            }
+
+            const u64 commitStartTime = (in_desc.m_stats != nullptr) ? ParticleStats::GetTimestamp() : 0;
+
+            in_desc.m_concurrentParticleData->CommitParticleData(in_desc.m_particleArray.get(), AABB(centre, size), Sphere(centre, size.Length() * 0.5f));
+
+            if (in_desc.m_stats != nullptr)
+            {
+                in_desc.m_stats->AddCommit(ParticleStats::GetTimestamp() - commitStartTime);
+            }
+        }
+        //----------------------------------------------------------------
+        /// Updates the particles of a single effect on a background
+        /// thread. This will emit new particles, update existing particles
+        /// and apply particle affectors. These changes will then be
+        /// committed to the draw data array to update the next render.
+        ///
+        /// @author agent
+        ///
+        /// @param in_desc - The particle update description. This contains
+        /// a snapshot of all data required to update the particle effect.
+        //----------------------------------------------------------------
+        void UpdateParticleEffect(const ParticleSystem::UpdateDesc& in_desc)
+        {
+            if (in_desc.m_prewarmDuration > 0.0f)
+            {
+                Prewarm(in_desc);
+            }
+
+            //calculate the normalised playback progress. This is used for every step, as emission only occurs once.
+            const f32 effectProgress = in_desc.m_playbackTime / in_desc.m_particleEffect->GetDuration();
+            const u32 numSteps = CalculateNumSteps(in_desc);
+            const f32 deltaTime = in_desc.m_deltaTime / f32(numSteps);
+
+            for (u32 step = 1; step < numSteps; ++step)
+            {
+                ParticleIntegration::Integrate(in_desc.m_particleArray.get(), deltaTime);
+                RemoveInactiveParticles(in_desc.m_particleArray.get(), in_desc.m_particleAffectors);
+
+                const u32 numParticles = in_desc.m_particleArray->GetNumActiveParticles();
+                for (auto& affector : in_desc.m_particleAffectors)
+                {
+                    affector->AffectParticles(deltaTime, effectProgress, 0, numParticles);
+                }
+            }
+
+            if (in_desc.m_timeStep > 0.0f)
+            {
+                in_desc.m_particleArray->StorePreviousPositions(0, in_desc.m_particleArray->GetNumActiveParticles());
+            }
+
+            //update the particles, calculating the bounds of those which survive as part of the same pass. Affectors
+            //never move particles, so these are also the bounds after the affectors have been applied.
+            Vector3 min = GetEmptyBoundsMin();
+            Vector3 max = GetEmptyBoundsMax();
+            if (in_desc.m_particleEffect->UsesPredictedBounds() == true)
+            {
+                ParticleIntegration::Integrate(in_desc.m_particleArray.get(), deltaTime);
+            }
+            else
+            {
+                ParticleIntegration::Integrate(in_desc.m_particleArray.get(), deltaTime, min, max);
+            }
+            RemoveInactiveParticles(in_desc.m_particleArray.get(), in_desc.m_particleAffectors);
+
+            const u32 numParticles = in_desc.m_particleArray->GetNumActiveParticles();
+
+            //apply affectors
+            for (auto& affector : in_desc.m_particleAffectors)
+            {
+                affector->AffectParticles(deltaTime, effectProgress, 0, numParticles);
+            }
+
+            EmitAndCommit(in_desc, effectProgress, min, max);
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The number of particles.
+        /// @param The number of chunks.
+        /// @param The chunk index.
+        ///
+        /// @return The start of the given chunk. Chunk boundaries are
+        /// always a multiple of the integration batch size.
+        //----------------------------------------------------------------
+        u32 CalculateChunkStart(u32 in_numParticles, u32 in_numChunks, u32 in_chunkIndex)
+        {
+            if (in_chunkIndex >= in_numChunks)
+            {
+                return in_numParticles;
+            }
+
+            const u64 start = (u64(in_numParticles) * in_chunkIndex) / in_numChunks;
+            return u32(start - (start % 4));
+        }
+        //----------------------------------------------------------------
+        /// Integrates the effects particles across multiple tasks for the
+        /// current step of the update. Once complete, dead particles are
+        /// removed serially and the affectors are applied. The bounds of
+        /// each range are only calculated during the final step, prior to
+        /// which the previous positions are stored if a time step is used.
+        ///
+        /// @author agent
+        ///
+        /// @param The parallel update.
+        //----------------------------------------------------------------
+        void IntegrateParticlesParallel(const std::shared_ptr<ParallelUpdate>& in_update);
+        //----------------------------------------------------------------
+        /// Applies the affectors to the effects particles across multiple
+        /// tasks. Once complete, the next step is integrated if there are
+        /// any remaining. Otherwise the partial bounds calculated during
+        /// integration are reduced, and emission and commiting are
+        /// performed serially.
+        ///
+        /// @author agent
+        ///
+        /// @param The parallel update.
+        //----------------------------------------------------------------
+        void AffectParticlesParallel(const std::shared_ptr<ParallelUpdate>& in_update)
+        {
+            //dead particles have been removed since the chunks were decided, so the chunk ranges are recalculated.
+            const u32 numParticles = in_update->m_desc.m_particleArray->GetNumActiveParticles();
+
+            std::vector<Task> tasks;
+            tasks.reserve(in_update->m_numChunks);
+            for (u32 chunk = 0; chunk < in_update->m_numChunks; ++chunk)
+            {
+                const u32 start = CalculateChunkStart(numParticles, in_update->m_numChunks, chunk);
+                const u32 end = CalculateChunkStart(numParticles, in_update->m_numChunks, chunk + 1);
+                tasks.push_back([=](const TaskContext&) noexcept
+                {
+                    const u64 startTime = ParticleStats::GetTimestamp();
+
+                    for (auto& affector : in_update->m_desc.m_particleAffectors)
+                    {
+                        affector->AffectParticles(in_update->m_stepDeltaTime, in_update->m_effectProgress, start, end);
+                    }
+
+                    in_update->m_desc.m_stats->AddUpdateTask(ParticleStats::GetTimestamp() - startTime);
+                });
+            }
+
+            Application::Get()->GetTaskScheduler()->ScheduleTasks(TaskType::k_small, tasks, [=](const TaskContext&) noexcept
+            {
+                if (++in_update->m_stepIndex < in_update->m_numSteps)
+                {
+                    IntegrateParticlesParallel(in_update);
+                    return;
+                }
+
+                const u64 startTime = ParticleStats::GetTimestamp();
+
+                Vector3 min = GetEmptyBoundsMin();
+                Vector3 max = GetEmptyBoundsMax();
+                for (u32 chunk = 0; chunk < in_update->m_numChunks; ++chunk)
+                {
+                    min = Vector3::Min(min, in_update->m_chunkMins[chunk]);
+                    max = Vector3::Max(max, in_update->m_chunkMaxs[chunk]);
+                }
+
+                EmitAndCommit(in_update->m_desc, in_update->m_effectProgress, min, max);
+
+                in_update->m_desc.m_stats->AddUpdateTask(ParticleStats::GetTimestamp() - startTime);
+                in_update->m_completionDelegate();
+            });
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void IntegrateParticlesParallel(const std::shared_ptr<ParallelUpdate>& in_update)
+        {
+            const bool isFinalStep = (in_update->m_stepIndex + 1 == in_update->m_numSteps);
+            const bool calculateBounds = (isFinalStep == true && in_update->m_desc.m_particleEffect->UsesPredictedBounds() == false);
+            const bool storePreviousPositions = (isFinalStep == true && in_update->m_desc.m_timeStep > 0.0f);
+            const u32 numParticles = in_update->m_desc.m_particleArray->GetNumActiveParticles();
+
+            std::vector<Task> tasks;
+            tasks.reserve(in_update->m_numChunks);
+            for (u32 chunk = 0; chunk < in_update->m_numChunks; ++chunk)
+            {
+                const u32 start = CalculateChunkStart(numParticles, in_update->m_numChunks, chunk);
+                const u32 end = CalculateChunkStart(numParticles, in_update->m_numChunks, chunk + 1);
+                tasks.push_back([=](const TaskContext&) noexcept
+                {
+                    const u64 startTime = ParticleStats::GetTimestamp();
+
+                    if (storePreviousPositions == true)
+                    {
+                        in_update->m_desc.m_particleArray->StorePreviousPositions(start, end);
+                    }
+
+                    //the chunk bounds are not affected by the removal of dead particles, as the union of all chunks is still correct.
+                    if (calculateBounds == true)
+                    {
+                        ParticleIntegration::IntegrateRange(in_update->m_desc.m_particleArray.get(), start, end, in_update->m_stepDeltaTime, in_update->m_chunkMins[chunk], in_update->m_chunkMaxs[chunk]);
+                    }
+                    else
+                    {
+                        ParticleIntegration::IntegrateRange(in_update->m_desc.m_particleArray.get(), start, end, in_update->m_stepDeltaTime);
+                    }
+
+                    in_update->m_desc.m_stats->AddUpdateTask(ParticleStats::GetTimestamp() - startTime);
+                });
+            }
+
+            Application::Get()->GetTaskScheduler()->ScheduleTasks(TaskType::k_small, tasks, [=](const TaskContext&) noexcept
+            {
+                const u64 startTime = ParticleStats::GetTimestamp();
+
+                RemoveInactiveParticles(in_update->m_desc.m_particleArray.get(), in_update->m_desc.m_particleAffectors);
+                AffectParticlesParallel(in_update);
+
+                in_update->m_desc.m_stats->AddUpdateTask(ParticleStats::GetTimestamp() - startTime);
+            });
+        }
+        //----------------------------------------------------------------
+        /// Updates the particles of a single large effect across multiple
+        /// tasks. The integration and affector passes of each step are
+        /// split into ranges which are processed concurrently, with the
+        /// bounds of each range calculated during the final integration,
+        /// while removal of dead particles, emission and commiting are
+        /// performed serially in completion tasks. This produces the same
+        /// result as UpdateParticleEffect().
+        ///
+        /// @author agent
+        ///
+        /// @param The particle update description.
+        /// @param The number of chunks to split each pass into.
+        /// @param The delegate called once the particle data has been
+        /// committed.
+        //----------------------------------------------------------------
+        void UpdateParticleEffectParallel(const ParticleSystem::UpdateDesc& in_desc, u32 in_numChunks, const std::function<void()>& in_completionDelegate)
+        {
+            CS_ASSERT(in_desc.m_prewarmDuration <= 0.0f, "Prewarmed effects cannot be updated in parallel.");
+
+            auto update = std::make_shared<ParallelUpdate>();
+            update->m_desc = in_desc;
+            update->m_completionDelegate = in_completionDelegate;
+            update->m_effectProgress = in_desc.m_playbackTime / in_desc.m_particleEffect->GetDuration();
+            update->m_numSteps = CalculateNumSteps(in_desc);
+            update->m_stepDeltaTime = in_desc.m_deltaTime / f32(update->m_numSteps);
+            update->m_numChunks = in_numChunks;
+            update->m_chunkMins.resize(in_numChunks, GetEmptyBoundsMin());
+            update->m_chunkMaxs.resize(in_numChunks, GetEmptyBoundsMax());
+
+            IntegrateParticlesParallel(update);
+        }
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The update description.
+        ///
+        /// @return The estimated cost of updating the described effect,
+        /// measured in particles. Each step is assumed to cost the same,
+        /// and prewarming is assumed to update the max number of
+        /// particles for each prewarm time step.
+        //----------------------------------------------------------------
+        u32 CalculateUpdateCost(const ParticleSystem::UpdateDesc& in_desc)
+        {
+            u32 cost = CalculateNumSteps(in_desc) * in_desc.m_particleArray->GetNumActiveParticles() + k_effectUpdateCost;
+
+            if (in_desc.m_prewarmDuration > 0.0f)
+            {
+                const u32 numPrewarmSteps = u32(std::ceil(in_desc.m_prewarmDuration / k_prewarmTimeStep));
+                cost += numPrewarmSteps * (in_desc.m_particleArray->GetCapacity() + k_effectUpdateCost);
+            }
+
+            return cost;
+        }
+    }
+
+    CS_DEFINE_NAMEDTYPE(ParticleSystem);
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleSystemUPtr ParticleSystem::Create()
+    {
+        return ParticleSystemUPtr(new ParticleSystem());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleSystem::ParticleSystem()
+        : m_memoryManager(new ParticleMemoryManager()), m_stats(new ParticleStats())
+    {
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleSystem::~ParticleSystem()
+    {
+        //scheduled updates reference the system, so must finish before it is destroyed.
+        WaitForUpdates();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    bool ParticleSystem::IsA(InterfaceIDType in_interfaceId) const
+    {
+        return (ParticleSystem::InterfaceID == in_interfaceId);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleMemoryManager* ParticleSystem::GetMemoryManager() const
+    {
+        return m_memoryManager.get();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleStats* ParticleSystem::GetStats() const
+    {
+        return m_stats.get();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32 ParticleSystem::GetStatsLogInterval() const
+    {
+        return m_statsLogInterval;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::SetStatsLogInterval(f32 in_interval)
+    {
+        CS_ASSERT(in_interval >= 0.0f, "Particle stats log interval cannot be negative.");
+
+        m_statsLogInterval = in_interval;
+        m_timeSinceStatsLog = 0.0f;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    ParticleSystem::SchedulingMode ParticleSystem::GetSchedulingMode() const
+    {
+        return m_schedulingMode;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::SetSchedulingMode(SchedulingMode in_schedulingMode)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "The particle scheduling mode can only be set on the main thread.");
+        CS_ASSERT(m_queuedUpdates.empty() == true, "The particle scheduling mode cannot be changed while particle updates are queued.");
+
+        WaitForUpdates();
+        m_schedulingMode = in_schedulingMode;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 ParticleSystem::GetNumFixedUpdatesPerStep() const
+    {
+        return m_numFixedUpdatesPerStep;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::SetNumFixedUpdatesPerStep(u32 in_numFixedUpdates)
+    {
+        m_numFixedUpdatesPerStep = in_numFixedUpdates;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32 ParticleSystem::GetFixedTimeStep() const
+    {
+        return Application::Get()->GetUpdateInterval() * f32(m_numFixedUpdatesPerStep);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::QueueUpdate(UpdateDesc&& in_desc)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Particle updates can only be queued on the main thread.");
+        CS_ASSERT(in_desc.m_particleEffect != nullptr, "Cannot update particles with null particle effect.");
+        CS_ASSERT(in_desc.m_particleArray != nullptr, "Cannot update particles with null particle array.");
+        CS_ASSERT(in_desc.m_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
+
+        if (m_isDestroyed == true)
+        {
+            return;
+        }
+
+        //main thread tasks are executed after the frame's update, so all updates queued this frame are scheduled together. In
+        //the frame deterministic mode they are instead scheduled at the start of the next frame's update.
+        if (m_schedulingMode == SchedulingMode::k_asynchronous && m_queuedUpdates.empty() == true)
+        {
+            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                ScheduleQueuedUpdates();
+            });
+        }
+
+        in_desc.m_stats = m_stats.get();
+        m_queuedUpdates.push_back(std::move(in_desc));
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::BakeSimulationCache(const ParticleEffectCSPtr& in_particleEffect, f32 in_bakeDuration, f32 in_frameRate, bool in_looping,
+        const ParticleSimulationCacheSPtr& out_simulationCache) const
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Simulation caches can only be baked on the main thread.");
+        CS_ASSERT(in_particleEffect != nullptr, "Cannot bake a null particle effect.");
+        CS_ASSERT(in_particleEffect->GetEmitterDef() != nullptr, "Cannot bake a particle effect without an emitter.");
+        CS_ASSERT(in_bakeDuration > 0.0f, "Bake duration must be greater than zero.");
+        CS_ASSERT(in_frameRate > 0.0f, "Bake frame rate must be greater than zero.");
+        CS_ASSERT(out_simulationCache != nullptr, "Cannot bake into a null simulation cache.");
+
+        const u32 maxParticles = in_particleEffect->GetMaxParticles();
+        const f32 duration = in_particleEffect->GetDuration();
+
+        //the bake uses its own memory manager so it isn't throttled by the global particle budget. This is declared prior
+        //to the update description so that it outlives all of the particle storage.
+        ParticleMemoryManager memoryManager;
+
+        UpdateDesc desc;
+        desc.m_particleEffect = in_particleEffect;
+        desc.m_particleArray = std::make_shared<ParticleArray>(maxParticles, &memoryManager);
+        desc.m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(maxParticles, &memoryManager);
+        desc.m_entityPosition = Vector3::k_zero;
+        desc.m_entityScale = Vector3::k_one;
+        desc.m_entityOrientation = Quaternion::k_identity;
+        desc.m_deltaTime = 1.0f / in_frameRate;
+        desc.m_looping = in_looping;
+
+        ParticleEmitterSPtr emitter = in_particleEffect->GetEmitterDef()->CreateInstance(desc.m_particleArray.get());
+        for (const auto& affectorDef : in_particleEffect->GetAffectorDefs())
+        {
+            desc.m_particleAffectors.push_back(affectorDef->CreateInstance(desc.m_particleArray.get()));
+        }
+
+        //the prewarm simulates from the start of the effect, so playback continues from where it finishes.
+        f32 playbackTime = 0.0f;
+        if (in_looping == true && in_particleEffect->GetPrewarmDuration() > 0.0f)
+        {
+            desc.m_prewarmDuration = in_particleEffect->GetPrewarmDuration();
+            playbackTime = std::fmod(desc.m_prewarmDuration, duration);
+        }
+
+        ParticleSimulationCache::Recorder recorder(in_frameRate, maxParticles);
+        const u32 numFrames = std::max(u32(std::ceil(in_bakeDuration * in_frameRate)), 1u);
+        for (u32 frame = 0; frame < numFrames; ++frame)
+        {
+            playbackTime += desc.m_deltaTime;
+            desc.m_particleEmitter = emitter;
+
+            if (in_looping == true)
+            {
+                while (playbackTime >= duration)
+                {
+                    playbackTime -= duration;
+                }
+            }
+            else if (playbackTime >= duration)
+            {
+                playbackTime = duration;
+                desc.m_particleEmitter = nullptr;
+            }
+
+            desc.m_playbackTime = playbackTime;
+            desc.m_interpolateEmission = (frame > 0);
+
+            bool updateStarted = desc.m_concurrentParticleData->StartUpdate();
+            CS_ASSERT(updateStarted == true, "Failed to start simulation cache update.");
+
+            UpdateParticleEffect(desc);
+            desc.m_concurrentParticleData->FetchCommittedData();
+            desc.m_prewarmDuration = 0.0f;
+
+            recorder.AddFrame(desc.m_concurrentParticleData->GetNumParticles(), desc.m_concurrentParticleData->GetParticles().data(), desc.m_concurrentParticleData->GetAABB());
+        }
+
+        recorder.Build(out_simulationCache.get());
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::OnUpdate(f32 in_deltaTime)
+    {
+        m_stats->EndFrame(m_memoryManager->GetNumLiveParticles());
+
+        //systems are updated prior to the states, so the updates queued last frame run concurrently with the rest of this
+        //frame's update. Main thread tasks are executed at the end of the frame's update, so are used to wait for them.
+        if (m_schedulingMode == SchedulingMode::k_frameDeterministic && m_queuedUpdates.empty() == false)
+        {
+            ScheduleQueuedUpdates();
+
+            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                //the updates will already have been waited on if the application was destroyed before the task was executed.
+                if (m_isDestroyed == false)
+                {
+                    WaitForUpdates();
+                }
+            });
+        }
+
+        m_timeSinceStatsLog += in_deltaTime;
+        if (m_statsLogInterval > 0.0f && m_timeSinceStatsLog >= m_statsLogInterval)
+        {
+            m_timeSinceStatsLog = 0.0f;
+
+            const ParticleStats::Frame frame = m_stats->GetLastFrame();
+            CS_LOG_VERBOSE("Particle Stats: " + ToString(frame.m_numActiveParticles) + " active, " + ToString(frame.m_numEmittedParticles) + " emitted, " +
+                ToString(frame.m_numDroppedEmissions) + " dropped, " + ToString(frame.m_numUpdates) + " updates, " + ToString(frame.m_numSkippedUpdates) + " skipped, " +
+                ToString(frame.m_numUpdateTasks) + " tasks taking " + ToString(frame.m_updateTaskTime, 3) + "ms (max " + ToString(frame.m_maxUpdateTaskTime, 3) + "ms), commit " +
+                ToString(frame.m_commitTime, 3) + "ms");
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::OnPreDestroy()
+    {
+        m_isDestroyed = true;
+        WaitForUpdates();
+
+        //in the frame deterministic mode updates queued last frame are still waiting to be scheduled, and will now never be.
+        m_queuedUpdates.clear();
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::ScheduleQueuedUpdates()
+    {
+        if (m_isDestroyed == true || m_queuedUpdates.empty() == true)
+        {
+            return;
+        }
+
+        auto updates = std::make_shared<std::vector<UpdateDesc>>();
+        updates->swap(m_queuedUpdates);
+
+        //in the frame deterministic mode updates are started as they are scheduled. All previous updates were waited on
+        //prior to the last render, so this can only fail if the same effect was queued twice.
+        if (m_schedulingMode == SchedulingMode::k_frameDeterministic)
+        {
+            updates->erase(std::remove_if(updates->begin(), updates->end(), [=](const UpdateDesc& in_update)
+            {
+                if (in_update.m_concurrentParticleData->StartUpdate() == true)
+                {
+                    return false;
+                }
+
+                CS_LOG_ERROR("Failed to start a frame deterministic particle update.");
+                m_stats->AddSkippedUpdate();
+                return true;
+            }), updates->end());
+
+            if (updates->empty() == true)
+            {
+                return;
+            }
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_updatesInProgressMutex);
+            m_numUpdatesInProgress += u32(updates->size());
+        }
+
+        auto taskScheduler = Application::Get()->GetTaskScheduler();
+        const u32 numThreads = std::max(taskScheduler->GetNumSmallTaskThreads(), 1u);
+
+        //the particle arrays are not accessed by any task until scheduled, so can safely be read here. Very large
+        //effects are moved to the end of the list as they are split across all threads rather than chunked. Prewarming
+        //effects have no particles yet and are always updated serially.
+        auto largeUpdatesBegin = updates->end();
+        if (numThreads > 1)
+        {
+            largeUpdatesBegin = std::stable_partition(updates->begin(), updates->end(), [](const UpdateDesc& in_update)
+            {
+                return (in_update.m_prewarmDuration > 0.0f || in_update.m_particleArray->GetNumActiveParticles() < k_parallelUpdateThreshold);
+            });
+        }
+
+        const u32 numSmallUpdates = u32(largeUpdatesBegin - updates->begin());
+
+        u32 totalCost = 0;
+        for (u32 i = 0; i < numSmallUpdates; ++i)
+        {
+            totalCost += CalculateUpdateCost((*updates)[i]);
+        }
+
+        const u32 numChunks = std::min(numThreads, numSmallUpdates);
+        const u32 targetChunkCost = (numChunks > 0) ? (totalCost + numChunks - 1) / numChunks : 0;
+
+        std::vector<Task> tasks;
+        tasks.reserve(numChunks);
+
+        u32 chunkStart = 0;
+        u32 chunkCost = 0;
+        for (u32 i = 0; i < numSmallUpdates; ++i)
+        {
+            chunkCost += CalculateUpdateCost((*updates)[i]);
+
+            u32 chunkEnd = i + 1;
+            if (chunkCost >= targetChunkCost || chunkEnd == numSmallUpdates)
+            {
+                tasks.push_back([=](const TaskContext&) noexcept
+                {
+                    const u64 startTime = ParticleStats::GetTimestamp();
+
+                    for (u32 j = chunkStart; j < chunkEnd; ++j)
+                    {
+                        UpdateParticleEffect((*updates)[j]);
+                    }
+
+                    m_stats->AddUpdateTask(ParticleStats::GetTimestamp() - startTime);
+                    OnUpdatesFinished(chunkEnd - chunkStart);
+                });
+
+                chunkStart = chunkEnd;
+                chunkCost = 0;
+            }
+        }
+
+        for (u32 i = numSmallUpdates; i < updates->size(); ++i)
+        {
+            const u32 numParticles = (*updates)[i].m_particleArray->GetNumActiveParticles();
+            UpdateParticleEffectParallel((*updates)[i], std::min(numThreads, numParticles / k_minParallelChunkSize), [=]()
+            {
+                OnUpdatesFinished(1);
+            });
+        }
+
+        if (tasks.empty() == false)
+        {
+            taskScheduler->ScheduleTasks(TaskType::k_small, tasks);
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::OnUpdatesFinished(u32 in_numUpdates)
+    {
+        std::unique_lock<std::mutex> lock(m_updatesInProgressMutex);
+
+        CS_ASSERT(m_numUpdatesInProgress >= in_numUpdates, "More particle updates finished than were scheduled.");
+        m_numUpdatesInProgress -= in_numUpdates;
+
+        if (m_numUpdatesInProgress == 0)
+        {
+            m_updatesFinishedCondition.notify_all();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void ParticleSystem::WaitForUpdates()
+    {
+        std::unique_lock<std::mutex> lock(m_updatesInProgressMutex);
+        m_updatesFinishedCondition.wait(lock, [=]()
+        {
+            return (m_numUpdatesInProgress == 0);
+        });
+    }
+}
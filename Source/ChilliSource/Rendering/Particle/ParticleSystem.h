@@ -0,0 +1,345 @@
+//
+//  ParticleSystem.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESYSTEM_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESYSTEM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------
+    /// A system which batches the background updates of all particle
+    /// effects. Particle effect components queue an update description each
+    /// frame they need updating, and once all components have been updated
+    /// the queued effects are gathered into a small number of tasks, one per
+    /// worker thread, balanced by particle count. This avoids the overhead
+    /// of scheduling a separate task for every effect.
+    ///
+    /// Updates can either be scheduled asynchronously, or in a frame
+    /// deterministic manner which always simulates every frame and has a
+    /// fixed latency of a single frame. See SchedulingMode for details.
+    ///
+    /// The system also gathers statistics describing the particle work
+    /// performed each frame, which can be queried or periodically logged.
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------
+    class ParticleSystem final : public AppSystem
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(ParticleSystem);
+        //----------------------------------------------------------------
+        /// The modes in which queued updates can be scheduled.
+        ///
+        /// In the asynchronous mode, updates are scheduled at the end of
+        /// the frame in which they were queued, and run concurrently with
+        /// rendering and subsequent frames. If the previous update of an
+        /// effect hasn't finished when the next is due, the next is
+        /// skipped and its time is simulated by the following update.
+        ///
+        /// In the frame deterministic mode, updates queued during a frame
+        /// are scheduled at the start of the next frame's update, so run
+        /// concurrently with the rest of it, and are waited on at the end
+        /// of it, prior to rendering. Updates are never skipped and the
+        /// rendered particles are always a single frame behind the game.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        enum class SchedulingMode
+        {
+            k_asynchronous,
+            k_frameDeterministic
+        };
+        //----------------------------------------------------------------
+        /// A container for all information required by the background
+        /// update of a single particle effect. If a prewarm duration is
+        /// given the effect will be simulated for that long using coarse
+        /// time steps prior to the update, finishing at the playback time
+        /// at the start of the update. This is used both to prewarm new
+        /// effects and to catch up effects which were not simulated while
+        /// out of view. The prewarm of a looping effect wraps around the
+        /// duration, while the prewarm of a non-looping effect is clamped
+        /// to the start and end of the effect.
+        ///
+        /// If a time step is given, the delta time is simulated in steps
+        /// of that size, and the particle positions prior to the final
+        /// step are committed so that drawing can interpolate from them.
+        /// The delta time should be a multiple of the time step.
+        ///
+        /// The stats are set by the system when the update is queued.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        struct UpdateDesc final
+        {
+            ParticleEffectCSPtr m_particleEffect;
+            ParticleEmitterSPtr m_particleEmitter;
+            std::vector<ParticleAffectorSPtr> m_particleAffectors;
+            ParticleVertexBuilderSPtr m_vertexBuilder;
+            ParticleArraySPtr m_particleArray;
+            ConcurrentParticleDataSPtr m_concurrentParticleData;
+            f32 m_playbackTime = 0.0f;
+            f32 m_deltaTime = 0.0f; 
+            f32 m_timeStep = 0.0f;
+            Vector3 m_entityPosition;
+            Vector3 m_entityScale;
+            Quaternion m_entityOrientation;
+            bool m_interpolateEmission = false;
+            bool m_looping = false;
+            f32 m_prewarmDuration = 0.0f;
+            f32 m_emissionRateScale = 1.0f;
+            f32 m_maxParticlesScale = 1.0f;
+            ParticleStats* m_stats = nullptr;
+        };
+        //----------------------------------------------------------------
+        /// Allows querying of whether or not this implements the interface
+        /// described by the given interface Id.
+        /// 
+        /// @author agent
+        ///
+        /// @param The interface Id.
+        ///
+        /// @return Whether this implements the interface.
+        //----------------------------------------------------------------
+        bool IsA(InterfaceIDType in_interfaceId) const override;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The memory manager which all particle effect storage is
+        /// allocated from. This can be used to configure the particle
+        /// memory arena and the global particle budget, and to query
+        /// their occupancy.
+        //----------------------------------------------------------------
+        ParticleMemoryManager* GetMemoryManager() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The particle statistics. The statistics for the
+        /// previous frame can be queried with GetLastFrame(); these are
+        /// gathered at the start of each frame's update.
+        //----------------------------------------------------------------
+        ParticleStats* GetStats() const;
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The interval in seconds at which the particle
+        /// statistics are logged. Zero indicates they are not logged.
+        //----------------------------------------------------------------
+        f32 GetStatsLogInterval() const;
+        //----------------------------------------------------------------
+        /// Sets the interval at which the statistics for the previous
+        /// frame are logged. Defaults to zero, which disables logging.
+        ///
+        /// @author agent
+        ///
+        /// @param The interval in seconds.
+        //----------------------------------------------------------------
+        void SetStatsLogInterval(f32 in_interval);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The mode in which queued updates are scheduled.
+        //----------------------------------------------------------------
+        SchedulingMode GetSchedulingMode() const;
+        //----------------------------------------------------------------
+        /// Sets the mode in which queued updates are scheduled. This waits
+        /// for any updates which are in progress to finish, and cannot be
+        /// called while there are updates queued, so should be called
+        /// outside of the scene update, for example when a state is
+        /// created. Defaults to asynchronous.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The scheduling mode.
+        //----------------------------------------------------------------
+        void SetSchedulingMode(SchedulingMode in_schedulingMode);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The number of application fixed updates per particle
+        /// simulation step. Zero indicates particles are simulated using
+        /// the variable frame delta time.
+        //----------------------------------------------------------------
+        u32 GetNumFixedUpdatesPerStep() const;
+        //----------------------------------------------------------------
+        /// Sets the number of application fixed updates per particle
+        /// simulation step. If greater than zero, particle effects are
+        /// simulated in fixed time steps driven by the application fixed
+        /// update, so they behave the same regardless of frame rate, and
+        /// particle positions are interpolated between steps when drawn.
+        /// Values greater than one can be used to simulate particles at a
+        /// lower rate than they are rendered. Defaults to zero, which
+        /// simulates particles using the variable frame delta time.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of fixed updates per step.
+        //----------------------------------------------------------------
+        void SetNumFixedUpdatesPerStep(u32 in_numFixedUpdates);
+        //----------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The duration of a single particle simulation step in
+        /// seconds. This is the application update interval multiplied
+        /// by the number of fixed updates per step, so is zero if fixed
+        /// time steps are not used.
+        //----------------------------------------------------------------
+        f32 GetFixedTimeStep() const;
+        //----------------------------------------------------------------
+        /// Queues the background update of a particle effect. All updates
+        /// queued during a frame are scheduled together once the frame's
+        /// update has finished. The concurrent particle data of the effect
+        /// must have been successfully passed through StartUpdate() prior
+        /// to calling this, unless the frame deterministic scheduling mode
+        /// is used, in which case the system starts the update when it is
+        /// scheduled.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The update description. This is moved into the queue.
+        //----------------------------------------------------------------
+        void QueueUpdate(UpdateDesc&& in_desc);
+        //----------------------------------------------------------------
+        /// Bakes a simulation of the given particle effect into the given
+        /// simulation cache. The effect is simulated on the calling thread
+        /// at a fixed frame rate, using the same update as queued updates,
+        /// as if it was being played by a component at the origin with no
+        /// rotation or scale. Looping effects are prewarmed if they have
+        /// a prewarm duration.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @author agent
+        ///
+        /// @param The particle effect.
+        /// @param The duration of the simulation to bake.
+        /// @param The number of frames per second to bake.
+        /// @param Whether or not the effect should loop. If it doesn't,
+        /// emission will stop after the duration of the effect.
+        /// @param [Out] The simulation cache which should be built.
+        //----------------------------------------------------------------
+        void BakeSimulationCache(const ParticleEffectCSPtr& in_particleEffect, f32 in_bakeDuration, f32 in_frameRate, bool in_looping,
+            const ParticleSimulationCacheSPtr& out_simulationCache) const;
+        //----------------------------------------------------------------
+        /// Destructor
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ~ParticleSystem();
+    private:
+        friend class Application;
+        //----------------------------------------------------------------
+        /// A factory method for creating new instances of the system.
+        ///
+        /// @author agent
+        ///
+        /// @return The new instance of the system.
+        //----------------------------------------------------------------
+        static ParticleSystemUPtr Create();
+        //----------------------------------------------------------------
+        /// Default constructor. Declared private to force the use of the
+        /// CreateSystem() method in Application.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        ParticleSystem();
+        //----------------------------------------------------------------
+        /// Gathers the statistics for the previous frame, logging them if
+        /// the log interval has elapsed.
+        ///
+        /// @author agent
+        ///
+        /// @param The delta time.
+        //----------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override;
+        //----------------------------------------------------------------
+        /// Waits for all in-flight updates to finish, discards any updates
+        /// which have been queued but not yet scheduled, and stops any
+        /// further updates from being scheduled. Parallel updates schedule
+        /// their later stages from worker threads, so this must happen
+        /// before the task scheduler is destroyed.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void OnPreDestroy() override;
+        //----------------------------------------------------------------
+        /// Splits all queued updates into chunks of roughly equal particle
+        /// count and schedules a single task for each chunk. In the frame
+        /// deterministic mode, each update is also started.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void ScheduleQueuedUpdates();
+        //----------------------------------------------------------------
+        /// Called when scheduled updates have committed their particle
+        /// data. This is thread-safe.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of updates which have finished.
+        //----------------------------------------------------------------
+        void OnUpdatesFinished(u32 in_numUpdates);
+        //----------------------------------------------------------------
+        /// Blocks until all scheduled updates have committed their
+        /// particle data.
+        ///
+        /// @author agent
+        //----------------------------------------------------------------
+        void WaitForUpdates();
+
+        ParticleMemoryManagerUPtr m_memoryManager;
+        ParticleStatsUPtr m_stats;
+        f32 m_statsLogInterval = 0.0f;
+        f32 m_timeSinceStatsLog = 0.0f;
+        SchedulingMode m_schedulingMode = SchedulingMode::k_asynchronous;
+        u32 m_numFixedUpdatesPerStep = 0;
+        bool m_isDestroyed = false;
+
+        std::mutex m_updatesInProgressMutex;
+        std::condition_variable m_updatesFinishedCondition;
+        u32 m_numUpdatesInProgress = 0;
+        std::vector<UpdateDesc> m_queuedUpdates;
+    };
+}
+
+#endif
@@ -59,6 +59,16 @@ namespace ChilliSource
         /// @return simply returns the static value.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress values.
+        /// These are ignored for a constant property.
+        /// @param The number of values to generate.
+        /// @param [In/Out] The random number generator used for any random values.
+        /// @param [Out] The generated values.
+        //------------------------------------------------------------------------------
+        void GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const override;
         
     private:
         TPropertyType m_value;
@@ -76,6 +86,15 @@ namespace ChilliSource
     {
         return m_value;
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void ConstantParticleProperty<TPropertyType>::GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const
+    {
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = m_value;
+        }
+    }
 }
 
 #endif
\ No newline at end of file
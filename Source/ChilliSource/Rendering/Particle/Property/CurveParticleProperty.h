@@ -30,14 +30,15 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_CURVEPARTICLEPROPERTY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
 
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     /// A particle property describing a value which changes over the lifetime of
-    /// the particle effect. The curve function is described by a delegate provided
-    /// in the constructor.
+    /// the particle effect. The curve is described by either a standard curve type or
+    /// a delegate provided in the constructor.
     ///
     /// @author Ian Copland
     //------------------------------------------------------------------------------
@@ -54,7 +55,7 @@ namespace ChilliSource
         ///
         /// @return The interpolation factor.
         //------------------------------------------------------------------------------
-        using CurveFunction = std::function<f32(f32)>;
+        using CurveFunction = ParticleCurve::CurveFunction;
         //------------------------------------------------------------------------------
         /// Constructor.
         ///
@@ -66,6 +67,16 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         CurveParticleProperty(TPropertyType in_startValue, TPropertyType in_endValue, const CurveFunction& in_curveFunction);
         //------------------------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param The start value.
+        /// @param The end value.
+        /// @param The curve.
+        //------------------------------------------------------------------------------
+        CurveParticleProperty(TPropertyType in_startValue, TPropertyType in_endValue, const ParticleCurve& in_curve);
+        //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @param The normalised (0.0 - 1.0) particle effect playback progress.
@@ -73,19 +84,36 @@ namespace ChilliSource
         /// @return The generated value.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// Generates a value for each of the given playback progress values. The curve
+        /// is evaluated for the whole batch at once.
+        ///
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress values.
+        /// @param The number of values to generate.
+        /// @param [In/Out] The random number generator used for any random values.
+        /// @param [Out] The generated values.
+        //------------------------------------------------------------------------------
+        void GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const override;
         
     private:
         TPropertyType m_startValue;
         TPropertyType m_endValue;
-        CurveFunction m_curveFunction;
+        ParticleCurve m_curve;
     };
     
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     template <typename TPropertyType> CurveParticleProperty<TPropertyType>::CurveParticleProperty(TPropertyType in_startValue, TPropertyType in_endValue, const CurveFunction& in_curveFunction)
-        : m_startValue(in_startValue), m_endValue(in_endValue), m_curveFunction(in_curveFunction)
+        : m_startValue(in_startValue), m_endValue(in_endValue), m_curve(in_curveFunction)
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> CurveParticleProperty<TPropertyType>::CurveParticleProperty(TPropertyType in_startValue, TPropertyType in_endValue, const ParticleCurve& in_curve)
+        : m_startValue(in_startValue), m_endValue(in_endValue), m_curve(in_curve)
     {
-        CS_ASSERT(m_curveFunction != nullptr, "A curve function must be provided.");
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -93,10 +121,28 @@ namespace ChilliSource
     {
         CS_ASSERT(in_playbackProgress >= 0.0f && in_playbackProgress <= 1.0f, "Playback progress must be in the range 0.0 to 1.0.");
         
-        f32 interpolationFactor = m_curveFunction(in_playbackProgress);
+        f32 interpolationFactor = m_curve.Evaluate(in_playbackProgress);
         
         return TPropertyType(m_startValue + (m_endValue - m_startValue) * interpolationFactor);
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void CurveParticleProperty<TPropertyType>::GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const
+    {
+        const u32 k_maxBatchSize = 64;
+        f32 interpolationFactors[k_maxBatchSize];
+        
+        for (u32 valueIndex = 0; valueIndex < in_numValues; valueIndex += k_maxBatchSize)
+        {
+            u32 batchSize = std::min(k_maxBatchSize, in_numValues - valueIndex);
+            m_curve.Evaluate(in_playbackProgress + valueIndex, batchSize, interpolationFactors);
+            
+            for (u32 i = 0; i < batchSize; ++i)
+            {
+                out_values[valueIndex + i] = TPropertyType(m_startValue + (m_endValue - m_startValue) * interpolationFactors[i]);
+            }
+        }
+    }
 }
 
 #endif
\ No newline at end of file
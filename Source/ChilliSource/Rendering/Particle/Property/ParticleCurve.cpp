@@ -0,0 +1,286 @@
+//
+//  ParticleCurve.cpp
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
+
+#include <ChilliSource/Core/String/StringUtils.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        const char k_linearCurveName[] = "linear";
+        const char k_easeInQuadCurveName[] = "easeinquad";
+        const char k_easeOutQuadCurveName[] = "easeoutquad";
+        const char k_smoothStepCurveName[] = "smoothstep";
+        const char k_linearPingPongCurveName[] = "linearpingpong";
+        const char k_easeInQuadPingPongCurveName[] = "easeinquadpingpong";
+        const char k_easeOutQuadPingPongCurveName[] = "easeoutquadpingpong";
+        const char k_smoothStepPingPongCurveName[] = "smoothsteppingpong";
+
+        //------------------------------------------------------------------------------
+        /// These match the Interpolate functions of the same name, but are inlined
+        /// into the batch evaluation loops.
+        //------------------------------------------------------------------------------
+        inline f32 Linear(f32 in_x)
+        {
+            return in_x;
+        }
+        inline f32 EaseInQuad(f32 in_x)
+        {
+            return in_x * in_x;
+        }
+        inline f32 EaseOutQuad(f32 in_x)
+        {
+            return -in_x * (in_x - 2.0f);
+        }
+        inline f32 SmoothStep(f32 in_x)
+        {
+            return in_x * in_x * (3.0f - 2.0f * in_x);
+        }
+        template <f32 (*TCurve)(f32)> inline f32 PingPong(f32 in_x)
+        {
+            return (in_x < 0.5f) ? TCurve(in_x * 2.0f) : TCurve(2.0f * (1.0f - in_x));
+        }
+        //------------------------------------------------------------------------------
+        /// Evaluates a baked curve by interpolating between the two nearest samples.
+        /// The input is clamped so the lookup can never go out of bounds.
+        ///
+        /// @author agent
+        ///
+        /// @param The samples.
+        /// @param The number of samples. Must be at least 2.
+        /// @param The input x in the range 0.0 - 1.0.
+        ///
+        /// @return The output y.
+        //------------------------------------------------------------------------------
+        inline f32 EvaluateBaked(const f32* in_samples, u32 in_numSamples, f32 in_x)
+        {
+            const f32 scaledX = std::min(std::max(in_x, 0.0f), 1.0f) * f32(in_numSamples - 1);
+            const u32 index = std::min(u32(scaledX), in_numSamples - 2);
+            const f32 t = scaledX - f32(index);
+
+            return in_samples[index] + (in_samples[index + 1] - in_samples[index]) * t;
+        }
+        //------------------------------------------------------------------------------
+        /// Evaluates the given curve for each value.
+        ///
+        /// @author agent
+        ///
+        /// @param The input x values.
+        /// @param The number of values.
+        /// @param [Out] The output y values.
+        //------------------------------------------------------------------------------
+        template <f32 (*TCurve)(f32)> void EvaluateAll(const f32* in_x, u32 in_numValues, f32* out_y)
+        {
+            for (u32 i = 0; i < in_numValues; ++i)
+            {
+                out_y[i] = TCurve(in_x[i]);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ParticleCurve::ParticleCurve(Type in_type)
+        : m_type(in_type)
+    {
+        CS_ASSERT(m_type != Type::k_custom, "A custom curve must be created with a curve function.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ParticleCurve::ParticleCurve(const std::string& in_name)
+        : m_type(Type::k_linear)
+    {
+        std::string nameLower = in_name;
+        StringUtils::ToLowerCase(nameLower);
+
+        if (nameLower == k_linearCurveName)
+        {
+            m_type = Type::k_linear;
+        }
+        else if (nameLower == k_easeInQuadCurveName)
+        {
+            m_type = Type::k_easeInQuad;
+        }
+        else if (nameLower == k_easeOutQuadCurveName)
+        {
+            m_type = Type::k_easeOutQuad;
+        }
+        else if (nameLower == k_smoothStepCurveName)
+        {
+            m_type = Type::k_smoothStep;
+        }
+        else if (nameLower == k_linearPingPongCurveName)
+        {
+            m_type = Type::k_linearPingPong;
+        }
+        else if (nameLower == k_easeInQuadPingPongCurveName)
+        {
+            m_type = Type::k_easeInQuadPingPong;
+        }
+        else if (nameLower == k_easeOutQuadPingPongCurveName)
+        {
+            m_type = Type::k_easeOutQuadPingPong;
+        }
+        else if (nameLower == k_smoothStepPingPongCurveName)
+        {
+            m_type = Type::k_smoothStepPingPong;
+        }
+        else
+        {
+            CS_LOG_FATAL("Invalid particle curve name: " + in_name);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ParticleCurve::ParticleCurve(const CurveFunction& in_curveFunction)
+        : m_type(Type::k_custom), m_curveFunction(in_curveFunction)
+    {
+        CS_ASSERT(m_curveFunction != nullptr, "A curve function must be provided.");
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    ParticleCurve::Type ParticleCurve::GetType() const
+    {
+        return m_type;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ParticleCurve::Bake(u32 in_numSamples)
+    {
+        CS_ASSERT(in_numSamples >= 2, "A baked particle curve must have at least 2 samples.");
+
+        //clear any existing samples so that re-baking samples the curve itself rather than the old lookup table.
+        m_bakedSamples.clear();
+
+        std::vector<f32> samples(in_numSamples);
+        for (u32 i = 0; i < in_numSamples; ++i)
+        {
+            samples[i] = Evaluate(f32(i) / f32(in_numSamples - 1));
+        }
+
+        m_bakedSamples = std::move(samples);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool ParticleCurve::IsBaked() const
+    {
+        return (m_bakedSamples.empty() == false);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    f32 ParticleCurve::Evaluate(f32 in_x) const
+    {
+        CS_ASSERT(in_x >= 0.0f && in_x <= 1.0f, "x must always be in the range 0.0 to 1.0 in particle curves.");
+
+        if (IsBaked() == true)
+        {
+            return EvaluateBaked(m_bakedSamples.data(), u32(m_bakedSamples.size()), in_x);
+        }
+
+        switch (m_type)
+        {
+            case Type::k_linear:
+                return Linear(in_x);
+            case Type::k_easeInQuad:
+                return EaseInQuad(in_x);
+            case Type::k_easeOutQuad:
+                return EaseOutQuad(in_x);
+            case Type::k_smoothStep:
+                return SmoothStep(in_x);
+            case Type::k_linearPingPong:
+                return PingPong<Linear>(in_x);
+            case Type::k_easeInQuadPingPong:
+                return PingPong<EaseInQuad>(in_x);
+            case Type::k_easeOutQuadPingPong:
+                return PingPong<EaseOutQuad>(in_x);
+            case Type::k_smoothStepPingPong:
+                return PingPong<SmoothStep>(in_x);
+            case Type::k_custom:
+                return m_curveFunction(in_x);
+            default:
+                CS_LOG_FATAL("Invalid particle curve type.");
+                return 0.0f;
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void ParticleCurve::Evaluate(const f32* in_x, u32 in_numValues, f32* out_y) const
+    {
+        if (IsBaked() == true)
+        {
+            const f32* samples = m_bakedSamples.data();
+            const u32 numSamples = u32(m_bakedSamples.size());
+            for (u32 i = 0; i < in_numValues; ++i)
+            {
+                out_y[i] = EvaluateBaked(samples, numSamples, in_x[i]);
+            }
+            return;
+        }
+
+        switch (m_type)
+        {
+            case Type::k_linear:
+                EvaluateAll<Linear>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_easeInQuad:
+                EvaluateAll<EaseInQuad>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_easeOutQuad:
+                EvaluateAll<EaseOutQuad>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_smoothStep:
+                EvaluateAll<SmoothStep>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_linearPingPong:
+                EvaluateAll<PingPong<Linear>>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_easeInQuadPingPong:
+                EvaluateAll<PingPong<EaseInQuad>>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_easeOutQuadPingPong:
+                EvaluateAll<PingPong<EaseOutQuad>>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_smoothStepPingPong:
+                EvaluateAll<PingPong<SmoothStep>>(in_x, in_numValues, out_y);
+                break;
+            case Type::k_custom:
+                for (u32 i = 0; i < in_numValues; ++i)
+                {
+                    out_y[i] = m_curveFunction(in_x[i]);
+                }
+                break;
+            default:
+                CS_LOG_FATAL("Invalid particle curve type.");
+                break;
+        }
+    }
+}
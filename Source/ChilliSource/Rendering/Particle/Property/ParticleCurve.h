@@ -0,0 +1,165 @@
+//
+//  ParticleCurve.h
+//  Chilli Source
+//  Created by agent on 17/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_PARTICLECURVE_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_PARTICLECURVE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <vector>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    /// A curve used by the curve particle properties. Accepts values in the range
+    /// 0.0 - 1.0 and outputs values in the range 0.0 - 1.0.
+    ///
+    /// The standard interpolate curves are described by a type, rather than a
+    /// delegate, so that when evaluating a batch of values the curve only needs
+    /// to be selected once rather than once per value. Any other curve can still
+    /// be described by a custom delegate.
+    ///
+    /// Any curve can optionally be baked into a lookup table when loaded, after
+    /// which evaluating it is a lerp between the two nearest samples regardless of
+    /// the curve type. This is primarily useful for custom curves, which would
+    /// otherwise require a delegate call per value.
+    ///
+    /// @author agent
+    //------------------------------------------------------------------------------
+    class ParticleCurve final
+    {
+    public:
+        //------------------------------------------------------------------------------
+        /// A delegate for a function which describes a custom curve.
+        ///
+        /// @author agent
+        ///
+        /// @param The input x in the range 0.0 - 1.0.
+        ///
+        /// @return The output y in the range 0.0 - 1.0.
+        //------------------------------------------------------------------------------
+        using CurveFunction = std::function<f32(f32)>;
+        //------------------------------------------------------------------------------
+        /// The types of curve. Each of the standard types corresponds to the
+        /// Interpolate function of the same name.
+        ///
+        /// @author agent
+        //------------------------------------------------------------------------------
+        enum class Type
+        {
+            k_linear,
+            k_easeInQuad,
+            k_easeOutQuad,
+            k_smoothStep,
+            k_linearPingPong,
+            k_easeInQuadPingPong,
+            k_easeOutQuadPingPong,
+            k_smoothStepPingPong,
+            k_custom
+        };
+        //------------------------------------------------------------------------------
+        /// Constructor. Creates one of the standard curve types.
+        ///
+        /// @author agent
+        ///
+        /// @param The curve type. This cannot be custom.
+        //------------------------------------------------------------------------------
+        ParticleCurve(Type in_type);
+        //------------------------------------------------------------------------------
+        /// Constructor. Creates the standard curve with the given name. The name
+        /// is case insensitive and uses the same names as the Interpolate functions,
+        /// for example "EaseInQuad" or "SmoothStepPingPong".
+        ///
+        /// @author agent
+        ///
+        /// @param The curve name.
+        //------------------------------------------------------------------------------
+        explicit ParticleCurve(const std::string& in_name);
+        //------------------------------------------------------------------------------
+        /// Constructor. Creates a custom curve described by the given delegate.
+        ///
+        /// @author agent
+        ///
+        /// @param The curve function.
+        //------------------------------------------------------------------------------
+        ParticleCurve(const CurveFunction& in_curveFunction);
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return The curve type.
+        //------------------------------------------------------------------------------
+        Type GetType() const;
+        //------------------------------------------------------------------------------
+        /// Samples the curve at the given number of evenly spaced points, including
+        /// 0.0 and 1.0, and from then on evaluates the curve by interpolating between
+        /// the samples. If the curve is already baked the existing samples are
+        /// discarded and the curve is re-sampled.
+        ///
+        /// @author agent
+        ///
+        /// @param The number of samples. Must be at least 2.
+        //------------------------------------------------------------------------------
+        void Bake(u32 in_numSamples);
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @return Whether or not the curve has been baked into a lookup table.
+        //------------------------------------------------------------------------------
+        bool IsBaked() const;
+        //------------------------------------------------------------------------------
+        /// Evaluates the curve for a single value.
+        ///
+        /// @author agent
+        ///
+        /// @param The input x in the range 0.0 - 1.0.
+        ///
+        /// @return The output y in the range 0.0 - 1.0.
+        //------------------------------------------------------------------------------
+        f32 Evaluate(f32 in_x) const;
+        //------------------------------------------------------------------------------
+        /// Evaluates the curve for each of the given values. The curve type is
+        /// selected once for the whole batch.
+        ///
+        /// @author agent
+        ///
+        /// @param The input x values in the range 0.0 - 1.0.
+        /// @param The number of values.
+        /// @param [Out] The output y values. This must be large enough to hold the
+        /// requested number of values.
+        //------------------------------------------------------------------------------
+        void Evaluate(const f32* in_x, u32 in_numValues, f32* out_y) const;
+
+    private:
+        Type m_type;
+        CurveFunction m_curveFunction;
+        std::vector<f32> m_bakedSamples;
+    };
+}
+
+#endif
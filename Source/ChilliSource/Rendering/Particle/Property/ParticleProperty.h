@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_PARTICLEPROPERTY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 
 namespace ChilliSource
 {
@@ -58,12 +59,60 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         virtual TPropertyType GenerateValue(f32 in_playbackProgress) const = 0;
         //------------------------------------------------------------------------------
+        /// Generates a new value within the confines of the property's settings, in
+        /// the same way as GenerateValue(), except random properties draw from the
+        /// given generator rather than the shared Random functions. This should be
+        /// preferred when generating per-particle values.
+        ///
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress.
+        /// @param [In/Out] The random number generator used for any random values.
+        ///
+        /// @return The generated value.
+        //------------------------------------------------------------------------------
+        TPropertyType GenerateValue(f32 in_playbackProgress, FastRandom& inout_random) const;
+        //------------------------------------------------------------------------------
+        /// Generates a new value for each of the given playback progress values. This
+        /// is equivalent to calling GenerateValue() for each, but allows properties to
+        /// avoid per-value overhead when generating values for many particles at once.
+        /// Random properties draw from the given generator rather than the shared
+        /// Random functions, so this is not thread-safe for a given generator.
+        ///
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress values.
+        /// @param The number of values to generate.
+        /// @param [In/Out] The random number generator used for any random values.
+        /// @param [Out] The generated values. This must be large enough to hold the
+        /// requested number of values.
+        //------------------------------------------------------------------------------
+        virtual void GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const;
+        //------------------------------------------------------------------------------
         /// Destructor.
         ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
         virtual ~ParticleProperty() {};
     };
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> TPropertyType ParticleProperty<TPropertyType>::GenerateValue(f32 in_playbackProgress, FastRandom& inout_random) const
+    {
+        TPropertyType value;
+        GenerateValues(&in_playbackProgress, 1, inout_random, &value);
+        return value;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void ParticleProperty<TPropertyType>::GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const
+    {
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = GenerateValue(in_playbackProgress[i]);
+        }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -92,6 +92,10 @@ namespace ChilliSource
         /// "EaseOutQuadPingPong"
         /// "SmoothStepPingPong"
         ///
+        /// Each of the curve property types also takes an optional 'CurveResolution'
+        /// argument. If supplied, the curve is sampled that many times when loaded and
+        /// is evaluated from the resulting lookup table.
+        ///
         /// @author Ian Copland
         ///
         /// @param The json value.
@@ -99,6 +103,26 @@ namespace ChilliSource
         /// @return The output particle property.
         //------------------------------------------------------------------------------
         template <typename TType> ParticlePropertyUPtr<TType> CreateProperty(const Json::Value& in_json);
+        //------------------------------------------------------------------------------
+        /// Creates a new particle property for the type described in the template
+        /// parameter from the compiled form stored in the given binary chunk. The
+        /// property is read from the current read position of the chunk, which is
+        /// left at the end of the property.
+        ///
+        /// The compiled property starts with a u8 describing the property type, which
+        /// is the index of the type in the list above. Curve property types are then
+        /// followed by a u8 describing the curve type, which is the index of the curve
+        /// in the list above, and a u32 curve resolution, where zero indicates the
+        /// curve should not be baked. Finally, each of the values are stored in the
+        /// order listed above, in the same binary layout as the value type.
+        ///
+        /// @author agent
+        ///
+        /// @param The binary chunk.
+        ///
+        /// @return The output particle property.
+        //------------------------------------------------------------------------------
+        template <typename TType> ParticlePropertyUPtr<TType> CreateProperty(CSBinaryChunk* in_chunk);
     }
 }
 
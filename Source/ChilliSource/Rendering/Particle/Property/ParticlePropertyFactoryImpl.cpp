@@ -37,6 +37,38 @@ namespace ChilliSource
     {
         namespace Impl
         {
+            //------------------------------------------------------------------------------
+            //------------------------------------------------------------------------------
+            ParticleCurve CreateCurve(const std::string& in_curveName, const Json::Value& in_json)
+            {
+                ParticleCurve curve(in_curveName);
+                
+                Json::Value curveResolution = in_json.get(k_curveResolutionKey, Json::nullValue);
+                if (curveResolution.isNull() == false)
+                {
+                    CS_ASSERT(curveResolution.isString(), "'" + std::string(k_curveResolutionKey) + "' in curve property must be a string.");
+                    curve.Bake(ParseU32(curveResolution.asString()));
+                }
+                
+                return curve;
+            }
+            //------------------------------------------------------------------------------
+            //------------------------------------------------------------------------------
+            ParticleCurve ReadCurve(CSBinaryChunk* in_chunk)
+            {
+                const u8 curveType = in_chunk->Read<u8>();
+                CS_ASSERT(curveType < u8(ParticleCurve::Type::k_custom), "Invalid curve type in compiled particle property.");
+                
+                ParticleCurve curve(static_cast<ParticleCurve::Type>(curveType));
+                
+                const u32 curveResolution = in_chunk->Read<u32>();
+                if (curveResolution > 0)
+                {
+                    curve.Bake(curveResolution);
+                }
+                
+                return curve;
+            }
             //------------------------------------------------------------------------------
             //------------------------------------------------------------------------------
             template <> u32 ParseValue(const std::string& in_value)
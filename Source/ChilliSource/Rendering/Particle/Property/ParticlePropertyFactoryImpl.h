@@ -30,12 +30,13 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_PARTICLEPROPERTYFACTORYIMPL_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Math/Interpolate.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Rendering/Particle/Property/ComponentwiseRandomConstantParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/ComponentwiseRandomCurveParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/ConstantParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/CurveParticleProperty.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/RandomConstantParticleProperty.h>
 #include <ChilliSource/Rendering/Particle/Property/RandomCurveParticleProperty.h>
 
@@ -72,6 +73,23 @@ namespace ChilliSource
             static const char k_endLowerValueKey[] = "EndLowerValue";
             static const char k_endUpperValueKey[] = "EndUpperValue";
             static const char k_curveKey[] = "Curve";
+            static const char k_curveResolutionKey[] = "CurveResolution";
+            
+            //------------------------------------------------------------------------------
+            /// The property types used in compiled particle properties. These are in the
+            /// same order as the property types documented in ParticlePropertyFactory.
+            ///
+            /// @author agent
+            //------------------------------------------------------------------------------
+            enum class CompiledPropertyType : u8
+            {
+                k_constant,
+                k_randomConstant,
+                k_componentwiseRandomConstant,
+                k_curve,
+                k_randomCurve,
+                k_componentwiseRandomCurve
+            };
             
             //------------------------------------------------------------------------------
             /// A templated method for parsing values from a string.
@@ -87,6 +105,44 @@ namespace ChilliSource
                 CS_LOG_FATAL("Cannot parse value of this type.");
             }
             //------------------------------------------------------------------------------
+            /// Creates the curve with the given name. If the property json contains a
+            /// curve resolution, the curve is baked into a lookup table with that number
+            /// of samples.
+            ///
+            /// @author agent
+            ///
+            /// @param The curve name.
+            /// @param The json for the property the curve belongs to.
+            ///
+            /// @return The curve.
+            //------------------------------------------------------------------------------
+            ParticleCurve CreateCurve(const std::string& in_curveName, const Json::Value& in_json);
+            //------------------------------------------------------------------------------
+            /// Reads a compiled curve from the given binary chunk, baking it if a curve
+            /// resolution was supplied.
+            ///
+            /// @author agent
+            ///
+            /// @param The binary chunk.
+            ///
+            /// @return The curve.
+            //------------------------------------------------------------------------------
+            ParticleCurve ReadCurve(CSBinaryChunk* in_chunk);
+            //------------------------------------------------------------------------------
+            /// Reads a compiled value from the given binary chunk. Values are stored in
+            /// the same layout as the value type.
+            ///
+            /// @author agent
+            ///
+            /// @param The binary chunk.
+            ///
+            /// @return The value.
+            //------------------------------------------------------------------------------
+            template <typename TType> TType ReadValue(CSBinaryChunk* in_chunk)
+            {
+                return in_chunk->Read<TType>();
+            }
+            //------------------------------------------------------------------------------
             /// Creates a new constant particle property with the value described in the
             /// given string.
             ///
@@ -186,7 +242,7 @@ namespace ChilliSource
                 CS_ASSERT(endValue != Json::nullValue, "Must supply '" + std::string(k_endValueKey) + "' in '" + std::string(k_curveType) + "' property.");
                 CS_ASSERT(endValue.isString(), "'" + std::string(k_endValueKey) + "' in '" + std::string(k_curveType) + "' property must be a string.");
                 
-                return ParticlePropertyUPtr<TType>(new CurveParticleProperty<TType>(ParseValue<TType>(startValue.asString()), ParseValue<TType>(endValue.asString()), Interpolate::GetInterpolateFunction(curve.asString())));
+                return ParticlePropertyUPtr<TType>(new CurveParticleProperty<TType>(ParseValue<TType>(startValue.asString()), ParseValue<TType>(endValue.asString()), CreateCurve(curve.asString(), in_json)));
             }
             //------------------------------------------------------------------------------
             /// Creates a new random curve particle property with the value described in the
@@ -221,7 +277,7 @@ namespace ChilliSource
                 CS_ASSERT(endUpperValue.isString(), "'" + std::string(k_endUpperValueKey) + "' in '" + std::string(k_randomCurveType) + "' property must be a string.");
                 
                 return ParticlePropertyUPtr<TType>(new RandomCurveParticleProperty<TType>(ParseValue<TType>(startLowerValue.asString()), ParseValue<TType>(startUpperValue.asString()),
-                    ParseValue<TType>(endLowerValue.asString()), ParseValue<TType>(endUpperValue.asString()), Interpolate::GetInterpolateFunction(curve.asString())));
+                    ParseValue<TType>(endLowerValue.asString()), ParseValue<TType>(endUpperValue.asString()), CreateCurve(curve.asString(), in_json)));
             }
             //------------------------------------------------------------------------------
             /// Creates a new componentwise random curve particle property with the value
@@ -256,7 +312,7 @@ namespace ChilliSource
                 CS_ASSERT(endUpperValue.isString(), "'" + std::string(k_endUpperValueKey) + "' in '" + std::string(k_componentwiseRandomCurveType) + "' property must be a string.");
                 
                 return ParticlePropertyUPtr<TType>(new ComponentwiseRandomCurveParticleProperty<TType>(ParseValue<TType>(startLowerValue.asString()), ParseValue<TType>(startUpperValue.asString()),
-                    ParseValue<TType>(endLowerValue.asString()), ParseValue<TType>(endUpperValue.asString()), Interpolate::GetInterpolateFunction(curve.asString())));
+                    ParseValue<TType>(endLowerValue.asString()), ParseValue<TType>(endUpperValue.asString()), CreateCurve(curve.asString(), in_json)));
             }
             //------------------------------------------------------------------------------
             /// Specialisation for parsing u32 values.
@@ -429,6 +485,62 @@ namespace ChilliSource
             CS_LOG_FATAL("Failed to create particle property.");
             return nullptr;
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> ParticlePropertyUPtr<TType> CreateProperty(CSBinaryChunk* in_chunk)
+        {
+            CS_ASSERT(in_chunk != nullptr, "Cannot create a Particle Property from a null chunk.");
+            
+            const Impl::CompiledPropertyType type = static_cast<Impl::CompiledPropertyType>(in_chunk->Read<u8>());
+            switch (type)
+            {
+                case Impl::CompiledPropertyType::k_constant:
+                {
+                    const TType value = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new ConstantParticleProperty<TType>(value));
+                }
+                case Impl::CompiledPropertyType::k_randomConstant:
+                {
+                    const TType lowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType upperValue = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new RandomConstantParticleProperty<TType>(lowerValue, upperValue));
+                }
+                case Impl::CompiledPropertyType::k_componentwiseRandomConstant:
+                {
+                    const TType lowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType upperValue = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new ComponentwiseRandomConstantParticleProperty<TType>(lowerValue, upperValue));
+                }
+                case Impl::CompiledPropertyType::k_curve:
+                {
+                    ParticleCurve curve = Impl::ReadCurve(in_chunk);
+                    const TType startValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType endValue = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new CurveParticleProperty<TType>(startValue, endValue, std::move(curve)));
+                }
+                case Impl::CompiledPropertyType::k_randomCurve:
+                {
+                    ParticleCurve curve = Impl::ReadCurve(in_chunk);
+                    const TType startLowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType startUpperValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType endLowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType endUpperValue = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new RandomCurveParticleProperty<TType>(startLowerValue, startUpperValue, endLowerValue, endUpperValue, std::move(curve)));
+                }
+                case Impl::CompiledPropertyType::k_componentwiseRandomCurve:
+                {
+                    ParticleCurve curve = Impl::ReadCurve(in_chunk);
+                    const TType startLowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType startUpperValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType endLowerValue = Impl::ReadValue<TType>(in_chunk);
+                    const TType endUpperValue = Impl::ReadValue<TType>(in_chunk);
+                    return ParticlePropertyUPtr<TType>(new ComponentwiseRandomCurveParticleProperty<TType>(startLowerValue, startUpperValue, endLowerValue, endUpperValue, std::move(curve)));
+                }
+            }
+            
+            CS_LOG_FATAL("Failed to create compiled particle property.");
+            return nullptr;
+        }
     }
 }
 
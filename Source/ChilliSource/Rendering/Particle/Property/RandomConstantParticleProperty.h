@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_RANDOMCONSTANTPARTICLEPROPERTY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Core/Math/Random.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
 
@@ -63,6 +64,16 @@ namespace ChilliSource
         /// created with.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress values.
+        /// These are ignored for a random property.
+        /// @param The number of values to generate.
+        /// @param [In/Out] The random number generator used for any random values.
+        /// @param [Out] The generated values.
+        //------------------------------------------------------------------------------
+        void GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const override;
         
     private:
         TPropertyType m_lowerValue;
@@ -81,6 +92,15 @@ namespace ChilliSource
     {
         return Random::Generate(m_lowerValue, m_upperValue);
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void RandomConstantParticleProperty<TPropertyType>::GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const
+    {
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = inout_random.Generate(m_lowerValue, m_upperValue);
+        }
+    }
 }
 
 #endif
\ No newline at end of file
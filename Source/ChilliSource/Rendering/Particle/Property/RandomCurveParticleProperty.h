@@ -30,7 +30,9 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_PROPERTY_RANDOMCURVEPARTICLEPROPERTY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/FastRandom.h>
 #include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Rendering/Particle/Property/ParticleCurve.h>
 #include <ChilliSource/Rendering/Particle/Property/ParticleProperty.h>
 
 namespace ChilliSource
@@ -38,7 +40,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     /// A particle property describing a value which is randomly generated between
     /// bounds. The bounds changes over the lifetime of the particle effect. The
-    /// curve function is described by a delegate provided in the constructor.
+    /// curve is described by either a standard curve type or a delegate provided in
+    /// the constructor.
     ///
     /// @author Ian Copland
     //------------------------------------------------------------------------------
@@ -55,7 +58,7 @@ namespace ChilliSource
         ///
         /// @return The interpolation factor.
         //------------------------------------------------------------------------------
-        using CurveFunction = std::function<f32(f32)>;
+        using CurveFunction = ParticleCurve::CurveFunction;
         //------------------------------------------------------------------------------
         /// Constructor.
         ///
@@ -69,6 +72,18 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         RandomCurveParticleProperty(TPropertyType in_startLowerValue, TPropertyType in_startUpperValue, TPropertyType in_endLowerValue, TPropertyType in_endUpperValue, const CurveFunction& in_curveFunction);
         //------------------------------------------------------------------------------
+        /// Constructor.
+        ///
+        /// @author agent
+        ///
+        /// @param The start lower value.
+        /// @param The start upper value.
+        /// @param The end lower value.
+        /// @param The end upper value.
+        /// @param The curve.
+        //------------------------------------------------------------------------------
+        RandomCurveParticleProperty(TPropertyType in_startLowerValue, TPropertyType in_startUpperValue, TPropertyType in_endLowerValue, TPropertyType in_endUpperValue, const ParticleCurve& in_curve);
+        //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
         /// @param The normalised (0.0 - 1.0) particle effect playback progress.
@@ -76,22 +91,40 @@ namespace ChilliSource
         /// @return The generated value.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// Generates a value for each of the given playback progress values. The curve
+        /// is evaluated for the whole batch at once.
+        ///
+        /// @author agent
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress values.
+        /// @param The number of values to generate.
+        /// @param [In/Out] The random number generator used for any random values.
+        /// @param [Out] The generated values.
+        //------------------------------------------------------------------------------
+        void GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const override;
         
     private:
         TPropertyType m_startLowerValue;
         TPropertyType m_startUpperValue;
         TPropertyType m_endLowerValue;
         TPropertyType m_endUpperValue;
-        CurveFunction m_curveFunction;
+        ParticleCurve m_curve;
     };
     
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     template <typename TPropertyType> RandomCurveParticleProperty<TPropertyType>::RandomCurveParticleProperty(TPropertyType in_startLowerValue, TPropertyType in_startUpperValue, TPropertyType in_endLowerValue,
                                                                                                               TPropertyType in_endUpperValue, const CurveFunction& in_curveFunction)
-        : m_startLowerValue(in_startLowerValue), m_startUpperValue(in_startUpperValue), m_endLowerValue(in_endLowerValue), m_endUpperValue(in_endUpperValue), m_curveFunction(in_curveFunction)
+        : m_startLowerValue(in_startLowerValue), m_startUpperValue(in_startUpperValue), m_endLowerValue(in_endLowerValue), m_endUpperValue(in_endUpperValue), m_curve(in_curveFunction)
+    {
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> RandomCurveParticleProperty<TPropertyType>::RandomCurveParticleProperty(TPropertyType in_startLowerValue, TPropertyType in_startUpperValue, TPropertyType in_endLowerValue,
+                                                                                                              TPropertyType in_endUpperValue, const ParticleCurve& in_curve)
+        : m_startLowerValue(in_startLowerValue), m_startUpperValue(in_startUpperValue), m_endLowerValue(in_endLowerValue), m_endUpperValue(in_endUpperValue), m_curve(in_curve)
     {
-        CS_ASSERT(m_curveFunction != nullptr, "A curve function must be provided.");
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -99,13 +132,34 @@ namespace ChilliSource
     {
         CS_ASSERT(in_playbackProgress >= 0.0f && in_playbackProgress <= 1.0f, "Playback progress must be in the range 0.0 to 1.0.");
         
-        f32 interpolationFactor = m_curveFunction(in_playbackProgress);
+        f32 interpolationFactor = m_curve.Evaluate(in_playbackProgress);
         
         TPropertyType lowerBound = TPropertyType(m_startLowerValue + (m_endLowerValue - m_startLowerValue) * interpolationFactor);
         TPropertyType upperBound = TPropertyType(m_startUpperValue + (m_endUpperValue - m_startUpperValue) * interpolationFactor);
         
         return Random::Generate(lowerBound, upperBound);
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void RandomCurveParticleProperty<TPropertyType>::GenerateValues(const f32* in_playbackProgress, u32 in_numValues, FastRandom& inout_random, TPropertyType* out_values) const
+    {
+        const u32 k_maxBatchSize = 64;
+        f32 interpolationFactors[k_maxBatchSize];
+        
+        for (u32 valueIndex = 0; valueIndex < in_numValues; valueIndex += k_maxBatchSize)
+        {
+            u32 batchSize = std::min(k_maxBatchSize, in_numValues - valueIndex);
+            m_curve.Evaluate(in_playbackProgress + valueIndex, batchSize, interpolationFactors);
+            
+            for (u32 i = 0; i < batchSize; ++i)
+            {
+                TPropertyType lowerBound = TPropertyType(m_startLowerValue + (m_endLowerValue - m_startLowerValue) * interpolationFactors[i]);
+                TPropertyType upperBound = TPropertyType(m_startUpperValue + (m_endUpperValue - m_startUpperValue) * interpolationFactors[i]);
+                
+                out_values[valueIndex + i] = inout_random.Generate(lowerBound, upperBound);
+            }
+        }
+    }
 }
 
 #endif
\ No newline at end of file
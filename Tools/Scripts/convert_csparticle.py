@@ -0,0 +1,437 @@
+#!/usr/bin/python
+#
+#  convert_csparticle.py
+#  Chilli Source
+#  Created by agent on 17/10/2026.
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2026 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#
+
+#----------------------------------------------------------------------
+# Converts a json csparticle file into the compiled binary csparticle
+# format, which is loaded by the CSParticleProvider in preference to
+# the json file when it exists alongside it. The effect level values
+# and particle properties are fully parsed, while the drawable, emitter
+# and affector defs are stored as a compiled json tree, as they are
+# created by user extensible factories.
+#
+# The parameters to the tool are:
+#
+#    '--input' or '-i'   -> The input json csparticle file path.
+#    '--output' or '-o'  -> The output binary csparticle file path. This
+#                           should have the extension 'csparticlebin'.
+#
+# @author agent
+#----------------------------------------------------------------------
+
+import sys
+import os
+import re
+import json
+import struct
+
+FILE_FORMAT_ID = 2
+FILE_FORMAT_VERSION = 1
+
+SIMULATION_SPACES = ["local", "world"]
+PRIORITIES = ["low", "normal", "high"]
+LOD_METRICS = ["distance", "projectedsize"]
+PROPERTY_TYPES = ["constant", "randomconstant", "componentwiserandomconstant", "curve", "randomcurve", "componentwiserandomcurve"]
+CURVE_TYPES = ["linear", "easeinquad", "easeoutquad", "smoothstep", "linearpingpong", "easeinquadpingpong", "easeoutquadpingpong", "smoothsteppingpong"]
+
+PROPERTY_VALUE_KEYS = [
+    ["Value"],
+    ["LowerValue", "UpperValue"],
+    ["LowerValue", "UpperValue"],
+    ["StartValue", "EndValue"],
+    ["StartLowerValue", "StartUpperValue", "EndLowerValue", "EndUpperValue"],
+    ["StartLowerValue", "StartUpperValue", "EndLowerValue", "EndUpperValue"]]
+
+EFFECT_PROPERTIES = [
+    ["LifetimeProperty", "f32"],
+    ["InitialScaleProperty", "vector2"],
+    ["InitialRotationProperty", "f32"],
+    ["InitialColourProperty", "colour"],
+    ["InitialSpeedProperty", "f32"],
+    ["InitialAngularVelocityProperty", "f32"]]
+
+JSON_NULL = 0
+JSON_BOOL = 1
+JSON_INT = 2
+JSON_REAL = 3
+JSON_STRING = 4
+JSON_ARRAY = 5
+JSON_OBJECT = 6
+
+FLOAT_PREFIX_REGEX = re.compile(r"^\s*[-+]?(\d+\.?\d*|\.\d+)([eE][-+]?\d+)?")
+UINT_PREFIX_REGEX = re.compile(r"^\s*\+?\d+")
+
+#----------------------------------------------------------------------
+# Parses a float in the same way as the engine, where any invalid
+# trailing characters are ignored and an invalid string results in zero.
+#
+# @author agent
+#
+# @param The string.
+#
+# @return The float.
+#----------------------------------------------------------------------
+def parse_f32(string):
+    match = FLOAT_PREFIX_REGEX.match(string)
+    if match is None:
+        return 0.0
+    return float(match.group(0))
+
+#----------------------------------------------------------------------
+# Parses an unsigned integer in the same way as the engine, where any
+# invalid trailing characters are ignored and an invalid string results
+# in zero.
+#
+# @author agent
+#
+# @param The string.
+#
+# @return The unsigned integer.
+#----------------------------------------------------------------------
+def parse_u32(string):
+    match = UINT_PREFIX_REGEX.match(string)
+    if match is None:
+        return 0
+    return int(match.group(0))
+
+#----------------------------------------------------------------------
+# Parses a list of space separated floats.
+#
+# @author agent
+#
+# @param The string.
+# @param The number of floats.
+#
+# @return The list of floats.
+#----------------------------------------------------------------------
+def parse_f32_list(string, count):
+    values = [parse_f32(item) for item in string.split()]
+    if len(values) != count:
+        raise ValueError("Expected " + str(count) + " values but found '" + string + "'")
+    return values
+
+#----------------------------------------------------------------------
+# Parses a colour. Colours with three components are given an alpha of
+# one.
+#
+# @author agent
+#
+# @param The string.
+#
+# @return The list of colour components.
+#----------------------------------------------------------------------
+def parse_colour(string):
+    values = [parse_f32(item) for item in string.split()]
+    if len(values) == 3:
+        values.append(1.0)
+    if len(values) != 4:
+        raise ValueError("Invalid number of elements for Colour: '" + string + "'")
+    return values
+
+#----------------------------------------------------------------------
+# Parses an enum value case-insensitively.
+#
+# @author agent
+#
+# @param The string.
+# @param The list of lower case enum names, in enum order.
+# @param The description of the enum, used for errors.
+#
+# @return The index of the enum value.
+#----------------------------------------------------------------------
+def parse_enum(string, names, description):
+    lower_string = string.lower()
+    if lower_string not in names:
+        raise ValueError("Invalid " + description + ": '" + string + "'")
+    return names.index(lower_string)
+
+#----------------------------------------------------------------------
+# Reads a string value from a json object, returning the default if it
+# isn't present.
+#
+# @author agent
+#
+# @param The json object.
+# @param The key.
+# @param The default value.
+#
+# @return The string value.
+#----------------------------------------------------------------------
+def get_string(json_object, key, default):
+    if key not in json_object:
+        return default
+    value = json_object[key]
+    if not isinstance(value, type(u"")) and not isinstance(value, str):
+        raise ValueError("'" + key + "' value must be a string.")
+    return value
+
+#----------------------------------------------------------------------
+# Compiles a value of the given particle property value type.
+#
+# @author agent
+#
+# @param The string value.
+# @param The value type: 'f32', 'vector2' or 'colour'.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_value(string, value_type):
+    if value_type == "f32":
+        return struct.pack("<f", parse_f32(string))
+    elif value_type == "vector2":
+        return struct.pack("<2f", *parse_f32_list(string, 2))
+    elif value_type == "colour":
+        return struct.pack("<4f", *parse_colour(string))
+    raise ValueError("Unknown value type: " + value_type)
+
+#----------------------------------------------------------------------
+# Compiles a particle property. This is a u8 property type, followed by
+# a u8 curve type and u32 curve resolution for curve properties, and
+# then each of the values.
+#
+# @author agent
+#
+# @param The property json.
+# @param The value type.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_property(property_json, value_type):
+    property_type = parse_enum(get_string(property_json, "Type", ""), PROPERTY_TYPES, "particle property type")
+
+    output = struct.pack("<B", property_type)
+    if PROPERTY_TYPES[property_type].endswith("curve"):
+        curve_type = parse_enum(get_string(property_json, "Curve", ""), CURVE_TYPES, "particle curve")
+        curve_resolution = parse_u32(get_string(property_json, "CurveResolution", "0"))
+        output += struct.pack("<BI", curve_type, curve_resolution)
+
+    for key in PROPERTY_VALUE_KEYS[property_type]:
+        if key not in property_json:
+            raise ValueError("Must supply '" + key + "' in '" + PROPERTY_TYPES[property_type] + "' property.")
+        output += compile_value(get_string(property_json, key, ""), value_type)
+
+    return output
+
+#----------------------------------------------------------------------
+# Compiles the INFO chunk, which contains the effect level values. Any
+# values which are not present are given the engine defaults.
+#
+# @author agent
+#
+# @param The root json object.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_info_chunk(root_json):
+    output = struct.pack("<f", parse_f32(get_string(root_json, "Duration", "1")))
+    output += struct.pack("<f", parse_f32(get_string(root_json, "PrewarmDuration", "0")))
+    output += struct.pack("<I", parse_u32(get_string(root_json, "MaxParticles", "100")))
+    output += struct.pack("<B", parse_enum(get_string(root_json, "SimulationSpace", "local"), SIMULATION_SPACES, "simulation space"))
+    output += struct.pack("<B", parse_enum(get_string(root_json, "Priority", "normal"), PRIORITIES, "priority"))
+
+    predicted_bounds = [0.0, 0.0, 0.0]
+    if "PredictedBounds" in root_json:
+        keys = ["EmitterExtent", "MaxSpeed", "MaxLifetime"]
+        for key in root_json["PredictedBounds"]:
+            if key not in keys:
+                raise ValueError("Unknown key in predicted bounds: " + key)
+            predicted_bounds[keys.index(key)] = parse_f32(get_string(root_json["PredictedBounds"], key, ""))
+    output += struct.pack("<B3f", 1 if "PredictedBounds" in root_json else 0, *predicted_bounds)
+
+    output += struct.pack("<B", parse_enum(get_string(root_json, "LodMetric", "distance"), LOD_METRICS, "lod metric"))
+    lod_bands = root_json.get("LodBands", [])
+    output += struct.pack("<I", len(lod_bands))
+    for lod_band_json in lod_bands:
+        for key in lod_band_json:
+            if key not in ["Threshold", "EmissionRateScale", "MaxParticlesScale", "UpdateInterval"]:
+                raise ValueError("Unknown key in lod band: " + key)
+        output += struct.pack("<f", parse_f32(get_string(lod_band_json, "Threshold", "0")))
+        output += struct.pack("<f", parse_f32(get_string(lod_band_json, "EmissionRateScale", "1")))
+        output += struct.pack("<f", parse_f32(get_string(lod_band_json, "MaxParticlesScale", "1")))
+        output += struct.pack("<I", parse_u32(get_string(lod_band_json, "UpdateInterval", "1")))
+
+    return output
+
+#----------------------------------------------------------------------
+# Compiles the PROP chunk, which contains the initial particle value
+# properties in a fixed order, each preceded by a u8 flag describing
+# whether or not it is present.
+#
+# @author agent
+#
+# @param The root json object.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_prop_chunk(root_json):
+    output = b""
+    for property_name, value_type in EFFECT_PROPERTIES:
+        if property_name in root_json:
+            output += struct.pack("<B", 1) + compile_property(root_json[property_name], value_type)
+        else:
+            output += struct.pack("<B", 0)
+    return output
+
+#----------------------------------------------------------------------
+# Compiles a string as a u32 length followed by the utf-8 characters.
+#
+# @author agent
+#
+# @param The string.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_string(string):
+    data = string.encode("utf-8")
+    return struct.pack("<I", len(data)) + data
+
+#----------------------------------------------------------------------
+# Compiles a json value as a u8 type tag followed by the value. Arrays
+# and objects are stored as a u32 count followed by the values, with
+# each object value preceded by its key.
+#
+# @author agent
+#
+# @param The json value.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_json(value):
+    if value is None:
+        return struct.pack("<B", JSON_NULL)
+    elif isinstance(value, bool):
+        return struct.pack("<BB", JSON_BOOL, 1 if value else 0)
+    elif isinstance(value, int) and -2**31 <= value < 2**31:
+        return struct.pack("<Bi", JSON_INT, value)
+    elif isinstance(value, (int, float)):
+        return struct.pack("<Bd", JSON_REAL, float(value))
+    elif isinstance(value, list):
+        output = struct.pack("<BI", JSON_ARRAY, len(value))
+        for item in value:
+            output += compile_json(item)
+        return output
+    elif isinstance(value, dict):
+        output = struct.pack("<BI", JSON_OBJECT, len(value))
+        for key in sorted(value.keys()):
+            output += compile_string(key) + compile_json(value[key])
+        return output
+    return struct.pack("<B", JSON_STRING) + compile_string(value)
+
+#----------------------------------------------------------------------
+# Compiles the DEFS chunk, which contains the drawable, emitter and
+# affector defs as a compiled json tree.
+#
+# @author agent
+#
+# @param The root json object.
+#
+# @return The compiled bytes.
+#----------------------------------------------------------------------
+def compile_defs_chunk(root_json):
+    defs_json = {}
+    for key in ["Drawable", "Emitter", "Affectors"]:
+        if key in root_json:
+            defs_json[key] = root_json[key]
+    return compile_json(defs_json)
+
+#----------------------------------------------------------------------
+# Writes a Chilli Source chunked binary file. This consists of the
+# header, the chunk table and then the chunk data.
+#
+# @author agent
+#
+# @param The output file path.
+# @param The list of chunk id and chunk data pairs.
+#----------------------------------------------------------------------
+def write_chunked_file(file_path, chunks):
+    header_size = 20
+    chunk_table_entry_size = 12
+
+    output = b"CSCS" + struct.pack("<IIII", 9999, FILE_FORMAT_ID, FILE_FORMAT_VERSION, len(chunks))
+
+    offset = header_size + chunk_table_entry_size * len(chunks)
+    for chunk_id, chunk_data in chunks:
+        output += chunk_id.encode("ascii") + struct.pack("<II", offset, len(chunk_data))
+        offset += len(chunk_data)
+
+    for chunk_id, chunk_data in chunks:
+        output += chunk_data
+
+    with open(file_path, "wb") as output_file:
+        output_file.write(output)
+
+#----------------------------------------------------------------------
+# Converts the json csparticle file to a binary csparticle file.
+#
+# @author agent
+#
+# @param The input file path.
+# @param The output file path.
+#----------------------------------------------------------------------
+def convert(input_file_path, output_file_path):
+    print("Converting '" + input_file_path + "' to '" + output_file_path + "'")
+
+    with open(input_file_path, "r") as input_file:
+        root_json = json.load(input_file)
+
+    chunks = [
+        ["INFO", compile_info_chunk(root_json)],
+        ["PROP", compile_prop_chunk(root_json)],
+        ["DEFS", compile_defs_chunk(root_json)]]
+
+    if os.path.exists(os.path.dirname(os.path.abspath(output_file_path))) == False:
+        os.makedirs(os.path.dirname(os.path.abspath(output_file_path)))
+    write_chunked_file(output_file_path, chunks)
+
+#----------------------------------------------------------------------
+# The entry point into the script.
+#
+# @author agent
+#
+# @param The list of arguments.
+#----------------------------------------------------------------------
+def main(args):
+    input_file_path = ""
+    output_file_path = ""
+
+    argCount = len(args)
+    for i in range(0, argCount):
+        arg = args[i]
+
+        if (arg == "--input" or arg == "-i") and i+1 < argCount:
+            input_file_path = args[i+1]
+        if (arg == "--output" or arg == "-o") and i+1 < argCount:
+            output_file_path = args[i+1]
+
+    if len(input_file_path) > 0 and len(output_file_path) > 0:
+        convert(input_file_path, output_file_path)
+    else:
+        print("Incorrect arguments supplied.")
+
+if __name__ == "__main__":
+    main(sys.argv)